@@ -0,0 +1,86 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "allocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    struct threadCounters{
+        std::size_t allocations = 0;
+        std::size_t bytesInUse = 0;
+        std::size_t peakBytesInUse = 0;
+    };
+
+    thread_local threadCounters counters;
+
+    // every block is prefixed with its size so operator delete can subtract it again
+    constexpr std::size_t headerSize = alignof(std::max_align_t);
+
+    void* countedAllocate(std::size_t size){
+        auto block = static_cast<char*>(std::malloc(size + headerSize));
+        if (!block){
+            throw std::bad_alloc();
+        }
+        *reinterpret_cast<std::size_t*>(block) = size;
+        counters.allocations++;
+        counters.bytesInUse += size;
+        if (counters.bytesInUse > counters.peakBytesInUse){
+            counters.peakBytesInUse = counters.bytesInUse;
+        }
+        return block + headerSize;
+    }
+
+    void countedFree(void* memory){
+        if (!memory){
+            return;
+        }
+        auto block = static_cast<char*>(memory) - headerSize;
+        // memory freed on another thread than it was allocated on can make the counter wrap, it is only used for differences on one thread
+        counters.bytesInUse -= *reinterpret_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void* operator new(std::size_t size){
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size){
+    return countedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept{
+    countedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept{
+    countedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept{
+    countedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept{
+    countedFree(memory);
+}
+
+namespace allocationCounter{
+    std::size_t allocations(){
+        return counters.allocations;
+    }
+
+    std::size_t bytesInUse(){
+        return counters.bytesInUse;
+    }
+
+    std::size_t peakBytesInUse(){
+        return counters.peakBytesInUse;
+    }
+
+    void resetPeak(){
+        counters.peakBytesInUse = counters.bytesInUse;
+    }
+}
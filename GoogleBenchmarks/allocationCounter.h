@@ -0,0 +1,38 @@
+//
+// Created by elias on 16/10/2026.
+//
+
+#ifndef LIBFACTORY_ALLOCATIONCOUNTER_H
+#define LIBFACTORY_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * @brief per thread counters of the replaced global operator new, used by the benchmarks to report allocations
+ */
+namespace allocationCounter{
+    /**
+     * @brief function to get the amount of allocations made by the current thread
+     * @return the amount of calls to operator new on this thread
+     */
+    std::size_t allocations();
+
+    /**
+     * @brief function to get the amount of bytes currently allocated by the current thread
+     * @return the allocated bytes minus the freed bytes on this thread
+     */
+    std::size_t bytesInUse();
+
+    /**
+     * @brief function to get the highest bytesInUse() since the last call to resetPeak()
+     * @return the peak amount of bytes in use on this thread
+     */
+    std::size_t peakBytesInUse();
+
+    /**
+     * @brief function to start a new peak measurement at the current bytesInUse()
+     */
+    void resetPeak();
+}
+
+#endif //LIBFACTORY_ALLOCATIONCOUNTER_H
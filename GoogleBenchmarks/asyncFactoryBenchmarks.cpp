@@ -0,0 +1,97 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactoryAsync.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <thread>
+
+// an event loop tick that needs one object from a creator that blocks for 100us, the benchmarks measure only the tick (manual time) and not the waiting that keeps the backlog bounded,
+// the iterations are fixed because the async ticks are so short that the automatic iteration count would queue creations for minutes
+
+struct benchAsyncBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchAsyncBase() = default;
+};
+
+struct benchAsyncObject: public benchAsyncBase{
+    // stands in for loading a file or a model
+    benchAsyncObject() { std::this_thread::sleep_for(std::chrono::microseconds(100)); }
+    static int getFactoryID(){ return 1; }
+};
+
+typedef libFactory::AsyncFactory<libFactory::BasicFactory<benchAsyncBase>> benchAsyncFactory;
+
+constexpr std::size_t benchAsyncMaxPending = 64;
+
+static void benchAsyncSetup(const benchmark::State&){
+    benchAsyncFactory::registerObject<benchAsyncObject>();
+    benchAsyncFactory::setWorkerCount(4);
+}
+
+static void benchAsyncTeardown(const benchmark::State&){
+    benchAsyncFactory::shutdown();
+    benchAsyncFactory::clearPrewarmed();
+    benchAsyncFactory::clearRegistry();
+}
+
+template<class function>
+static void benchAsyncTimeTick(benchmark::State& state, function&& tick){
+    auto start = std::chrono::steady_clock::now();
+    tick();
+    state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+// the creation blocks the event loop
+static void BM_eventLoopInlineCreate(benchmark::State& state){
+    for (auto _ : state){
+        benchAsyncTimeTick(state, [](){
+            benchmark::DoNotOptimize(benchAsyncFactory::create(benchAsyncObject::getFactoryID()));
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_eventLoopInlineCreate)->UseManualTime()->Iterations(2000)->Unit(benchmark::kMicrosecond)->Setup(benchAsyncSetup)->Teardown(benchAsyncTeardown);
+
+// the tick queues the creation and picks up the finished ones
+static void BM_eventLoopCreateAsync(benchmark::State& state){
+    std::deque<benchAsyncFactory::resultType> pending;
+    for (auto _ : state){
+        benchAsyncTimeTick(state, [&pending](){
+            pending.push_back(benchAsyncFactory::createAsync(benchAsyncObject::getFactoryID()));
+            while (!pending.empty() && pending.front().ready()){
+                benchmark::DoNotOptimize(pending.front().get());
+                pending.pop_front();
+            }
+        });
+        if (pending.size() >= benchAsyncMaxPending){
+            pending.front().wait();
+        }
+    }
+    for (auto& result : pending){
+        result.wait();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_eventLoopCreateAsync)->UseManualTime()->Iterations(2000)->Unit(benchmark::kMicrosecond)->Setup(benchAsyncSetup)->Teardown(benchAsyncTeardown);
+
+// the objects are prewarmed between the ticks, the tick takes one from the ready queue
+static void BM_eventLoopPrewarmed(benchmark::State& state){
+    for (auto _ : state){
+        if (benchAsyncFactory::getPrewarmedCount(benchAsyncObject::getFactoryID()) == 0){
+            benchAsyncFactory::prewarm(benchAsyncObject::getFactoryID(), benchAsyncMaxPending);
+            while (benchAsyncFactory::getPrewarmedCount(benchAsyncObject::getFactoryID()) != benchAsyncMaxPending){
+                std::this_thread::yield();
+            }
+        }
+        benchAsyncTimeTick(state, [](){
+            benchmark::DoNotOptimize(benchAsyncFactory::create(benchAsyncObject::getFactoryID()));
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_eventLoopPrewarmed)->UseManualTime()->Iterations(2000)->Unit(benchmark::kMicrosecond)->Setup(benchAsyncSetup)->Teardown(benchAsyncTeardown);
@@ -0,0 +1,113 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+struct benchBatchBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchBatchBase() = default;
+    virtual int value(){return a;}
+    int a = 1;
+};
+
+struct benchBatchDeriv: public benchBatchBase{
+    int value() override {return a + 1;}
+    char payload[48] = {};
+};
+
+typedef libFactory::BasicFactory<benchBatchBase> benchBatchFactory;
+
+static bool registerBatchBenchObjects(){
+    for (int i = 0; i < 1000; i++){
+        benchBatchFactory::registerObject<benchBatchDeriv>(i);
+    }
+    return true;
+}
+static const bool batchBenchObjectsRegistered = registerBatchBenchObjects();
+
+static void BM_loopedCreate(benchmark::State& state){
+    for (auto _ : state){
+        std::vector<std::unique_ptr<benchBatchBase>> objects;
+        objects.reserve(state.range(0));
+        for (int i = 0; i < state.range(0); i++){
+            objects.push_back(benchBatchFactory::create(500));
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_loopedCreate)->Arg(16)->Arg(1024)->Arg(16384);
+
+static void BM_batchCreate(benchmark::State& state){
+    for (auto _ : state){
+        auto batch = benchBatchFactory::createBatch(500, state.range(0));
+        benchmark::DoNotOptimize(batch[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_batchCreate)->Arg(16)->Arg(1024)->Arg(16384);
+
+static void BM_loopedCreateMixed(benchmark::State& state){
+    std::vector<int> ids(state.range(0));
+    for (std::size_t i = 0; i < ids.size(); i++){
+        ids[i] = static_cast<int>(i % 8) * 100;
+    }
+    for (auto _ : state){
+        std::vector<std::unique_ptr<benchBatchBase>> objects;
+        objects.reserve(ids.size());
+        for (int id : ids){
+            objects.push_back(benchBatchFactory::create(id));
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_loopedCreateMixed)->Arg(1024)->Arg(16384);
+
+static void BM_batchCreateMixed(benchmark::State& state){
+    std::vector<int> ids(state.range(0));
+    for (std::size_t i = 0; i < ids.size(); i++){
+        ids[i] = static_cast<int>(i % 8) * 100;
+    }
+    for (auto _ : state){
+        auto batch = benchBatchFactory::createBatch(std::span<const int>(ids));
+        benchmark::DoNotOptimize(batch[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_batchCreateMixed)->Arg(1024)->Arg(16384);
+
+// iterating the objects afterwards, the batch keeps them next to each other
+static void BM_iterateLooped(benchmark::State& state){
+    std::vector<std::unique_ptr<benchBatchBase>> objects;
+    for (int i = 0; i < state.range(0); i++){
+        objects.push_back(benchBatchFactory::create(i % 1000));
+    }
+    for (auto _ : state){
+        int sum = 0;
+        for (auto& object : objects){
+            sum += object->value();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_iterateLooped)->Arg(16384);
+
+static void BM_iterateBatch(benchmark::State& state){
+    auto batch = benchBatchFactory::createBatch(500, state.range(0));
+    for (auto _ : state){
+        int sum = 0;
+        for (auto object : batch){
+            sum += object->value();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_iterateBatch)->Arg(16384);
@@ -0,0 +1,58 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+struct benchHandleBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchHandleBase() = default;
+};
+
+static benchHandleBase benchHandleInstance;
+
+// raw pointers to a static object so only the dispatch is measured
+typedef libFactory::BasicFactory<benchHandleBase, int, benchHandleBase*> benchHandleIntFactory;
+typedef libFactory::BasicFactory<benchHandleBase, std::string, benchHandleBase*> benchHandleStringFactory;
+
+static bool registerHandleBenchCreators(){
+    for (int i = 0; i < 1000; i++){
+        benchHandleIntFactory::registerCreatorFunc(i, [](){ return &benchHandleInstance; });
+        benchHandleStringFactory::registerCreatorFunc("handler_" + std::to_string(i), [](){ return &benchHandleInstance; });
+    }
+    return true;
+}
+static const bool handleBenchCreatorsRegistered = registerHandleBenchCreators();
+
+static void BM_dispatchIntCreate(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchHandleIntFactory::create(500));
+    }
+}
+BENCHMARK(BM_dispatchIntCreate);
+
+static void BM_dispatchIntHandle(benchmark::State& state){
+    auto handle = benchHandleIntFactory::resolve(500);
+    for (auto _ : state){
+        benchmark::DoNotOptimize(handle());
+    }
+}
+BENCHMARK(BM_dispatchIntHandle);
+
+static void BM_dispatchStringCreate(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchHandleStringFactory::create("handler_500"));
+    }
+}
+BENCHMARK(BM_dispatchStringCreate);
+
+static void BM_dispatchStringHandle(benchmark::State& state){
+    auto handle = benchHandleStringFactory::resolve("handler_500");
+    for (auto _ : state){
+        benchmark::DoNotOptimize(handle());
+    }
+}
+BENCHMARK(BM_dispatchStringHandle);
@@ -0,0 +1,86 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+struct benchDenseBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchDenseBase() = default;
+};
+
+// the creator returns a shared instance so the benchmarks measure the registry lookup and not the allocation
+static benchDenseBase* benchDenseCreate(){
+    static benchDenseBase instance;
+    return &instance;
+}
+
+template<template<class, class> class registryStorage>
+using benchDenseFactory = libFactory::BasicFactory<benchDenseBase, int, benchDenseBase*, registryStorage>;
+
+/**
+ * @brief count ids starting at 0 with stride between them, shuffled so lookups do not walk the registry in order
+ */
+static std::vector<int> benchDenseIDs(std::int64_t count, int stride){
+    std::vector<int> ids;
+    for (int i = 0; i < static_cast<int>(count); i++){
+        ids.push_back(i * stride);
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(42));
+    return ids;
+}
+
+template<class factory, int stride>
+static void benchDenseFill(const benchmark::State& state){
+    factory::clearRegistry();
+    for (int id : benchDenseIDs(state.range(0), stride)){
+        factory::registerCreatorFunc(id, benchDenseCreate);
+    }
+}
+
+template<class factory>
+static void benchDenseClear(const benchmark::State&){
+    factory::clearRegistry();
+}
+
+template<class factory, int stride>
+static void BM_denseCreate(benchmark::State& state){
+    auto ids = benchDenseIDs(state.range(0), stride);
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(ids[i]));
+        if (++i == ids.size()){
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class factory>
+static void BM_denseRegister(benchmark::State& state){
+    auto ids = benchDenseIDs(state.range(0), 1);
+    for (auto _ : state){
+        for (int id : ids){
+            benchmark::DoNotOptimize(factory::registerCreatorFunc(id, benchDenseCreate));
+        }
+        factory::clearRegistry();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// dense ids 0 to n - 1, the dense table is a single index
+#define LIBFACTORY_DENSE_BENCHMARKS(storage) \
+    BENCHMARK_TEMPLATE(BM_denseCreate, benchDenseFactory<storage>, 1)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchDenseFill<benchDenseFactory<storage>, 1>)->Teardown(benchDenseClear<benchDenseFactory<storage>>); \
+    BENCHMARK_TEMPLATE(BM_denseCreate, benchDenseFactory<storage>, 1000)->Arg(1000)->Setup(benchDenseFill<benchDenseFactory<storage>, 1000>)->Teardown(benchDenseClear<benchDenseFactory<storage>>); \
+    BENCHMARK_TEMPLATE(BM_denseRegister, benchDenseFactory<storage>)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchDenseClear<benchDenseFactory<storage>>)
+
+// the stride 1000 run shows the sparse fallback of the dense storage
+LIBFACTORY_DENSE_BENCHMARKS(libFactory::DenseStorage);
+LIBFACTORY_DENSE_BENCHMARKS(libFactory::MapStorage);
+LIBFACTORY_DENSE_BENCHMARKS(libFactory::FlatStorage);
+LIBFACTORY_DENSE_BENCHMARKS(libFactory::HashStorage);
@@ -0,0 +1,117 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+// looks up 256 names that share a prefix of state.range(0) characters, like "net.protocol.handler.17", in a random order, once as std::string ids and once as libFactory::FactoryId
+
+struct benchIdStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~benchIdStringBase() = default;
+};
+
+struct benchIdHashedBase{
+    typedef libFactory::FactoryId __factoryIdentifierType__;
+    virtual ~benchIdHashedBase() = default;
+};
+
+// the creators hand out a static object so that only the lookup is measured
+typedef libFactory::BasicFactory<benchIdStringBase, std::string, benchIdStringBase*> benchIdStringMapFactory;
+typedef libFactory::BasicFactory<benchIdStringBase, std::string, benchIdStringBase*, libFactory::HashStorage> benchIdStringHashFactory;
+typedef libFactory::BasicFactory<benchIdHashedBase, libFactory::FactoryId, benchIdHashedBase*> benchIdHashedMapFactory;
+typedef libFactory::BasicFactory<benchIdHashedBase, libFactory::FactoryId, benchIdHashedBase*, libFactory::HashStorage> benchIdHashedHashFactory;
+
+constexpr std::size_t benchIdCount = 256;
+
+static const std::vector<std::string>& benchIdNames(std::size_t prefixLength){
+    static std::vector<std::string> names;
+    names.clear();
+    std::string prefix = "net.protocol.handler.";
+    prefix.resize(std::max(prefixLength, prefix.size()), '.');
+    for (std::size_t i = 0; i < benchIdCount; i++){
+        names.push_back(prefix + std::to_string(i));
+    }
+    return names;
+}
+
+static const std::vector<std::size_t>& benchIdOrder(){
+    static const std::vector<std::size_t> order = [](){
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<std::size_t> distribution(0, benchIdCount - 1);
+        std::vector<std::size_t> ret(1 << 16);
+        for (auto& index : ret){
+            index = distribution(generator);
+        }
+        return ret;
+    }();
+    return order;
+}
+
+template<class baseClass>
+static baseClass* benchIdInstance(){
+    static struct : baseClass{} instance;
+    return &instance;
+}
+
+template<class factory>
+static void BM_createStringId(benchmark::State& state){
+    const auto& names = benchIdNames(static_cast<std::size_t>(state.range(0)));
+    for (const auto& name : names){
+        factory::registerCreatorFunc(name, &benchIdInstance<benchIdStringBase>);
+    }
+    std::vector<std::string_view> ids(names.begin(), names.end());
+    const auto& order = benchIdOrder();
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(ids[order[i++ & 0xffff]]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    factory::clearRegistry();
+}
+BENCHMARK_TEMPLATE(BM_createStringId, benchIdStringMapFactory)->Arg(8)->Arg(32)->Arg(64);
+BENCHMARK_TEMPLATE(BM_createStringId, benchIdStringHashFactory)->Arg(8)->Arg(32)->Arg(64);
+
+// the ids are hashed up front, like a constexpr getFactoryID() or a FactoryId made from a string literal is
+template<class factory>
+static void BM_createFactoryId(benchmark::State& state){
+    const auto& names = benchIdNames(static_cast<std::size_t>(state.range(0)));
+    std::vector<libFactory::FactoryId> ids;
+    for (const auto& name : names){
+        ids.emplace_back(std::string_view(name));
+        factory::registerCreatorFunc(ids.back(), &benchIdInstance<benchIdHashedBase>);
+    }
+    const auto& order = benchIdOrder();
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(ids[order[i++ & 0xffff]]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    factory::clearRegistry();
+}
+BENCHMARK_TEMPLATE(BM_createFactoryId, benchIdHashedMapFactory)->Arg(8)->Arg(32)->Arg(64);
+BENCHMARK_TEMPLATE(BM_createFactoryId, benchIdHashedHashFactory)->Arg(8)->Arg(32)->Arg(64);
+
+// the names are only known at runtime and hashed on every call
+template<class factory>
+static void BM_createFactoryIdHashedPerCall(benchmark::State& state){
+    const auto& names = benchIdNames(static_cast<std::size_t>(state.range(0)));
+    for (const auto& name : names){
+        factory::registerCreatorFunc(libFactory::FactoryId(std::string_view(name)), &benchIdInstance<benchIdHashedBase>);
+    }
+    std::vector<std::string_view> ids(names.begin(), names.end());
+    const auto& order = benchIdOrder();
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(libFactory::FactoryId(ids[order[i++ & 0xffff]])));
+    }
+    state.SetItemsProcessed(state.iterations());
+    factory::clearRegistry();
+}
+BENCHMARK_TEMPLATE(BM_createFactoryIdHashedPerCall, benchIdHashedMapFactory)->Arg(8)->Arg(32)->Arg(64);
+BENCHMARK_TEMPLATE(BM_createFactoryIdHashedPerCall, benchIdHashedHashFactory)->Arg(8)->Arg(32)->Arg(64);
@@ -0,0 +1,70 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+struct benchInstanceBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchInstanceBase() = default;
+};
+
+// the creator returns a shared instance so the benchmarks measure the registry lookup and not the allocation
+static benchInstanceBase* benchInstanceCreate(){
+    static benchInstanceBase instance;
+    return &instance;
+}
+
+template<template<class, class> class registryStorage>
+using benchInstanceFactory = libFactory::BasicFactory<benchInstanceBase, int, benchInstanceBase*, registryStorage>;
+
+constexpr int benchInstanceIDCount = 1000;
+
+template<class factory>
+static typename factory::factoryInstance& benchInstanceGet(typename factory::replicationMode replication){
+    static typename factory::factoryInstance shared(factory::replicationMode::none);
+    static typename factory::factoryInstance replicated(factory::replicationMode::perThread);
+    static bool filled = [](){
+        for (int i = 0; i < benchInstanceIDCount; i++){
+            shared.registerCreatorFunc(i, benchInstanceCreate);
+            replicated.registerCreatorFunc(i, benchInstanceCreate);
+        }
+        return true;
+    }();
+    (void)filled;
+    return replication == factory::replicationMode::none ? shared : replicated;
+}
+
+/**
+ * @brief every thread creates random registered ids, with perThread each thread reads its own copy of the registry
+ * @note the id sequence is a lot longer than the registry so the branch predictor can not learn the lookup paths
+ */
+template<class factory, typename factory::replicationMode replication>
+static void BM_instanceCreate(benchmark::State& state){
+    auto& instance = benchInstanceGet<factory>(replication);
+    std::mt19937 random(static_cast<unsigned>(state.thread_index()));
+    std::uniform_int_distribution<int> distribution(0, benchInstanceIDCount - 1);
+    std::vector<int> ids(1 << 16);
+    for (int& id : ids){
+        id = distribution(random);
+    }
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(instance.create(ids[i]));
+        if (++i == ids.size()){
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define LIBFACTORY_INSTANCE_BENCHMARKS(storage) \
+    BENCHMARK_TEMPLATE(BM_instanceCreate, benchInstanceFactory<storage>, benchInstanceFactory<storage>::replicationMode::none)->ThreadRange(1, 8)->UseRealTime(); \
+    BENCHMARK_TEMPLATE(BM_instanceCreate, benchInstanceFactory<storage>, benchInstanceFactory<storage>::replicationMode::perThread)->ThreadRange(1, 8)->UseRealTime()
+
+LIBFACTORY_INSTANCE_BENCHMARKS(libFactory::MapStorage);
+LIBFACTORY_INSTANCE_BENCHMARKS(libFactory::HashStorage);
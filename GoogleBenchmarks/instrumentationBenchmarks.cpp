@@ -0,0 +1,66 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+struct benchInstrumentedBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchInstrumentedBase() = default;
+};
+
+static benchInstrumentedBase benchInstrumentedInstance;
+
+/**
+ * @brief factory with the create() of a factory without instrumentation support as reference
+ */
+class benchUninstrumentedFactory: public libFactory::FactoryBase<benchInstrumentedBase, libFactory::InplaceCreator<benchInstrumentedBase*()>, int, libFactory::HashStorage>{
+public:
+    static benchInstrumentedBase* create(int id){
+        if (auto entry = findEntry(id)){
+            return entry->creator();
+        }
+        return nullptr;
+    }
+};
+
+// raw pointers to a static object so the instrumentation is a measurable part of create()
+typedef libFactory::BasicFactory<benchInstrumentedBase, int, benchInstrumentedBase*, libFactory::HashStorage> benchDisabledFactory;
+typedef libFactory::BasicFactory<benchInstrumentedBase, int, benchInstrumentedBase*, libFactory::HashStorage, libFactory::CreationMetrics> benchEnabledFactory;
+
+static bool registerInstrumentationBenchCreators(){
+    benchUninstrumentedFactory::registerCreatorFunc(1, [](){ return &benchInstrumentedInstance; });
+    benchDisabledFactory::registerCreatorFunc(1, [](){ return &benchInstrumentedInstance; });
+    benchEnabledFactory::registerCreatorFunc(1, [](){ return &benchInstrumentedInstance; });
+    return true;
+}
+static const bool instrumentationBenchCreatorsRegistered = registerInstrumentationBenchCreators();
+
+static void BM_createUninstrumented(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchUninstrumentedFactory::create(1));
+    }
+}
+BENCHMARK(BM_createUninstrumented)->ThreadRange(1, 8);
+
+static void BM_createInstrumentationDisabled(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchDisabledFactory::create(1));
+    }
+}
+BENCHMARK(BM_createInstrumentationDisabled)->ThreadRange(1, 8);
+
+static void BM_createInstrumentationEnabled(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchEnabledFactory::create(1));
+    }
+}
+BENCHMARK(BM_createInstrumentationEnabled)->ThreadRange(1, 8);
+
+static void BM_createInstrumentationEnabledMiss(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchEnabledFactory::create(2));
+    }
+}
+BENCHMARK(BM_createInstrumentationEnabledMiss)->ThreadRange(1, 8);
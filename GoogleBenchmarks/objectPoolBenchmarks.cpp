@@ -0,0 +1,61 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+struct benchPoolBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchPoolBase() = default;
+    int a = 0;
+};
+
+struct benchPoolDeriv: public benchPoolBase{
+    char payload[56] = {};
+};
+
+typedef libFactory::BasicFactory<benchPoolBase> benchGlobalNewFactory;
+typedef libFactory::BasicFactory<benchPoolBase, int, libFactory::FactoryPtr<benchPoolBase>> benchPooledFactory;
+
+static bool registerPoolBenchObjects(){
+    return benchGlobalNewFactory::registerObject<benchPoolDeriv>(1) && benchPooledFactory::registerPooledObject<benchPoolDeriv>(1);
+}
+static const bool poolBenchObjectsRegistered = registerPoolBenchObjects();
+
+static void BM_createDestroyGlobalNew(benchmark::State& state){
+    for (auto _ : state){
+        auto ret = benchGlobalNewFactory::create(1);
+        benchmark::DoNotOptimize(ret.get());
+    }
+}
+BENCHMARK(BM_createDestroyGlobalNew)->ThreadRange(1, 8);
+
+static void BM_createDestroyPooled(benchmark::State& state){
+    for (auto _ : state){
+        auto ret = benchPooledFactory::create(1);
+        benchmark::DoNotOptimize(ret.get());
+    }
+}
+BENCHMARK(BM_createDestroyPooled)->ThreadRange(1, 8);
+
+// keeps a window of live objects so the allocator can not just hand back the last freed block
+static void BM_churnGlobalNew(benchmark::State& state){
+    std::unique_ptr<benchPoolBase> window[256];
+    std::size_t i = 0;
+    for (auto _ : state){
+        window[i++ & 255] = benchGlobalNewFactory::create(1);
+    }
+}
+BENCHMARK(BM_churnGlobalNew)->ThreadRange(1, 8);
+
+static void BM_churnPooled(benchmark::State& state){
+    libFactory::FactoryPtr<benchPoolBase> window[256];
+    std::size_t i = 0;
+    for (auto _ : state){
+        window[i++ & 255] = benchPooledFactory::create(1);
+    }
+}
+BENCHMARK(BM_churnPooled)->ThreadRange(1, 8);
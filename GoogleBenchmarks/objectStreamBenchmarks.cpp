@@ -0,0 +1,150 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+#include "allocationCounter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+// turns state.range(0) ids into 256 byte objects and sums them up, once by creating all objects into a vector first and once through createStream()
+
+struct benchObjStreamBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchObjStreamBase() = default;
+    virtual std::int64_t value() const = 0;
+    std::array<std::int64_t, 30> data{};
+};
+
+template<int id>
+struct benchObjStreamObject: public benchObjStreamBase{
+    std::int64_t value() const override { return id; }
+};
+
+typedef libFactory::BasicFactory<benchObjStreamBase> benchObjStreamFactory;
+
+template<int... ids>
+static void benchObjStreamRegister(std::integer_sequence<int, ids...>){
+    (benchObjStreamFactory::registerObject<benchObjStreamObject<ids>>(ids), ...);
+}
+
+static void benchObjStreamSetup(const benchmark::State&){
+    benchObjStreamRegister(std::make_integer_sequence<int, 8>());
+}
+
+static void benchObjStreamTeardown(const benchmark::State&){
+    benchObjStreamFactory::clearRegistry();
+}
+
+// ids in runs of runLength equal ids
+static std::vector<int> benchObjStreamIDs(std::size_t count, std::size_t runLength){
+    std::vector<int> ids(count);
+    for (std::size_t i = 0; i < count; i++){
+        ids[i] = static_cast<int>((i / runLength * 5) % 8);
+    }
+    return ids;
+}
+
+template<class function>
+static void benchObjStreamConsume(benchmark::State& state, function&& sum){
+    auto ids = benchObjStreamIDs(static_cast<std::size_t>(state.range(0)), 16);
+    std::size_t peak = 0;
+    for (auto _ : state){
+        std::size_t bytesBefore = allocationCounter::bytesInUse();
+        allocationCounter::resetPeak();
+        benchmark::DoNotOptimize(sum(ids));
+        peak = allocationCounter::peakBytesInUse() - bytesBefore;
+    }
+    state.counters["peakBytes"] = benchmark::Counter(static_cast<double>(peak));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_objectStreamEager(benchmark::State& state){
+    benchObjStreamConsume(state, [](const std::vector<int>& ids){
+        std::vector<std::unique_ptr<benchObjStreamBase>> objects;
+        objects.reserve(ids.size());
+        for (int id : ids){
+            objects.push_back(benchObjStreamFactory::create(id));
+        }
+        std::int64_t ret = 0;
+        for (const auto& object : objects){
+            ret += object->value();
+        }
+        return ret;
+    });
+}
+BENCHMARK(BM_objectStreamEager)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamSetup)->Teardown(benchObjStreamTeardown);
+
+static void BM_objectStreamLazy(benchmark::State& state){
+    benchObjStreamConsume(state, [](const std::vector<int>& ids){
+        std::int64_t ret = 0;
+        for (auto object : benchObjStreamFactory::createStream(ids)){
+            ret += object->value();
+        }
+        return ret;
+    });
+}
+BENCHMARK(BM_objectStreamLazy)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamSetup)->Teardown(benchObjStreamTeardown);
+
+struct benchObjStreamStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~benchObjStreamStringBase() = default;
+};
+
+typedef libFactory::BasicFactory<benchObjStreamStringBase> benchObjStreamStringFactory;
+
+template<class factory>
+static std::vector<typename factory::factoryIdentifierType> benchObjStreamRunIDs(std::size_t runLength){
+    std::vector<typename factory::factoryIdentifierType> ret;
+    for (int id : benchObjStreamIDs(1 << 16, runLength)){
+        if constexpr (std::is_same_v<typename factory::factoryIdentifierType, std::string>){
+            ret.push_back("net.protocol.handler." + std::to_string(id));
+        }else{
+            ret.push_back(id);
+        }
+    }
+    return ret;
+}
+
+static void benchObjStreamRunSetup(const benchmark::State& state){
+    benchObjStreamSetup(state);
+    for (int id = 0; id < 8; id++){
+        benchObjStreamStringFactory::registerObject<benchObjStreamStringBase>("net.protocol.handler." + std::to_string(id));
+    }
+}
+
+static void benchObjStreamRunTeardown(const benchmark::State& state){
+    benchObjStreamTeardown(state);
+    benchObjStreamStringFactory::clearRegistry();
+}
+
+// cost per object without keeping them, create() looks every id up, createStream() once per run of state.range(0) equal ids
+template<class factory>
+static void BM_objectStreamCreateLoop(benchmark::State& state){
+    auto ids = benchObjStreamRunIDs<factory>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state){
+        for (const auto& id : ids){
+            benchmark::DoNotOptimize(factory::create(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ids.size()));
+}
+BENCHMARK_TEMPLATE(BM_objectStreamCreateLoop, benchObjStreamFactory)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamRunSetup)->Teardown(benchObjStreamRunTeardown);
+BENCHMARK_TEMPLATE(BM_objectStreamCreateLoop, benchObjStreamStringFactory)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamRunSetup)->Teardown(benchObjStreamRunTeardown);
+
+template<class factory>
+static void BM_objectStreamRuns(benchmark::State& state){
+    auto ids = benchObjStreamRunIDs<factory>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state){
+        for (auto object : factory::createStream(ids)){
+            benchmark::DoNotOptimize(object);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ids.size()));
+}
+BENCHMARK_TEMPLATE(BM_objectStreamRuns, benchObjStreamFactory)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamRunSetup)->Teardown(benchObjStreamRunTeardown);
+BENCHMARK_TEMPLATE(BM_objectStreamRuns, benchObjStreamStringFactory)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond)->Setup(benchObjStreamRunSetup)->Teardown(benchObjStreamRunTeardown);
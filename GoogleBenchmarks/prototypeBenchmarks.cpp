@@ -0,0 +1,50 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+
+struct benchPrototypeBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchPrototypeBase() = default;
+};
+
+/**
+ * @brief object with an expensive constructor that builds a lookup table
+ */
+struct benchPrototypeTable: public benchPrototypeBase{
+    explicit benchPrototypeTable(double scale = 1.0){
+        for (std::size_t i = 0; i < table.size(); i++){
+            table[i] = static_cast<float>(std::sin(static_cast<double>(i) * scale) * std::exp(-static_cast<double>(i) / 256.0));
+        }
+    }
+
+    std::array<float, 512> table{};
+};
+
+typedef libFactory::BasicFactory<benchPrototypeBase> benchPrototypeFactory;
+
+static bool registerPrototypeBenchObjects(){
+    benchPrototypeFactory::registerObject<benchPrototypeTable>(1);
+    benchPrototypeFactory::registerPrototype<benchPrototypeTable>(2, 1.0);
+    return true;
+}
+static const bool prototypeBenchObjectsRegistered = registerPrototypeBenchObjects();
+
+static void BM_createConstructor(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchPrototypeFactory::create(1));
+    }
+}
+BENCHMARK(BM_createConstructor);
+
+static void BM_createPrototype(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchPrototypeFactory::create(2));
+    }
+}
+BENCHMARK(BM_createPrototype);
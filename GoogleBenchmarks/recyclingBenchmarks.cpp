@@ -0,0 +1,82 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+#include "allocationCounter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// create and destroy cycles of an object that owns a 256 byte buffer, once with new and delete, once from the object pool and once recycled
+
+struct benchRecycleBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchRecycleBase() = default;
+    virtual void fill(int value) = 0;
+};
+
+struct benchRecycleObject: public benchRecycleBase{
+    benchRecycleObject() { buffer.reserve(64); }
+    void fill(int value) override { buffer.assign(64, value); }
+    void reset() { buffer.clear(); }
+    std::vector<int> buffer;
+};
+
+typedef libFactory::BasicFactory<benchRecycleBase> benchRecycleNewFactory;
+typedef libFactory::BasicFactory<benchRecycleBase, int, libFactory::FactoryPtr<benchRecycleBase>> benchRecyclePtrFactory;
+
+static void benchRecycleSetup(const benchmark::State&){
+    benchRecycleNewFactory::registerObject<benchRecycleObject>(1);
+    benchRecyclePtrFactory::registerPooledObject<benchRecycleObject>(1);
+    benchRecyclePtrFactory::registerRecycledObject<benchRecycleObject>(2);
+}
+
+static void benchRecycleTeardown(const benchmark::State&){
+    benchRecycleNewFactory::clearRegistry();
+    benchRecyclePtrFactory::clearRegistry();
+}
+
+template<class function>
+static void benchRecycleCycle(benchmark::State& state, function&& make){
+    std::size_t allocationsBefore = allocationCounter::allocations();
+    for (auto _ : state){
+        auto ret = make();
+        ret->fill(1);
+        benchmark::DoNotOptimize(ret.get());
+    }
+    state.counters["allocsPerCycle"] = benchmark::Counter(static_cast<double>(allocationCounter::allocations() - allocationsBefore), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_recycleCycleNew(benchmark::State& state){
+    benchRecycleCycle(state, [](){ return benchRecycleNewFactory::create(1); });
+}
+BENCHMARK(BM_recycleCycleNew)->ThreadRange(1, 8)->Setup(benchRecycleSetup)->Teardown(benchRecycleTeardown);
+
+static void BM_recycleCyclePooled(benchmark::State& state){
+    benchRecycleCycle(state, [](){ return benchRecyclePtrFactory::create(1); });
+}
+BENCHMARK(BM_recycleCyclePooled)->ThreadRange(1, 8)->Setup(benchRecycleSetup)->Teardown(benchRecycleTeardown);
+
+static void BM_recycleCycleRecycled(benchmark::State& state){
+    benchRecycleCycle(state, [](){ return benchRecyclePtrFactory::create(2); });
+}
+BENCHMARK(BM_recycleCycleRecycled)->ThreadRange(1, 8)->Setup(benchRecycleSetup)->Teardown(benchRecycleTeardown);
+
+// keeps a window of live objects that is released on another thread, so recycled objects go through the queue of the thread that made them
+static void BM_recycleCrossThread(benchmark::State& state){
+    std::vector<libFactory::FactoryPtr<benchRecycleBase>> window;
+    window.reserve(256);
+    for (auto _ : state){
+        for (int i = 0; i < 256; i++){
+            window.push_back(benchRecyclePtrFactory::create(static_cast<int>(state.range(0))));
+        }
+        std::thread releaser([&window](){ window.clear(); });
+        releaser.join();
+    }
+    state.SetItemsProcessed(state.iterations() * 256);
+}
+BENCHMARK(BM_recycleCrossThread)->Arg(1)->Arg(2)->Setup(benchRecycleSetup)->Teardown(benchRecycleTeardown);
@@ -0,0 +1,165 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+struct benchScaleIntBase{
+    typedef int __factoryIdentifierType__;
+    benchScaleIntBase() = default;
+    explicit benchScaleIntBase(int a) : a(a) {}
+    virtual ~benchScaleIntBase() = default;
+    int a = 0;
+};
+
+struct benchScaleStringBase{
+    typedef std::string __factoryIdentifierType__;
+    benchScaleStringBase() = default;
+    explicit benchScaleStringBase(int a) : a(a) {}
+    virtual ~benchScaleStringBase() = default;
+    int a = 0;
+};
+
+template<class base>
+struct benchScaleObject: public base{
+    benchScaleObject() = default;
+    explicit benchScaleObject(int a) : base(a) {}
+};
+
+typedef libFactory::BasicFactory<benchScaleIntBase> benchScaleBasicIntFactory;
+typedef libFactory::BasicFactory<benchScaleStringBase> benchScaleBasicStringFactory;
+typedef libFactory::SingleArgumentFactory<benchScaleIntBase, int> benchScaleSingleArgIntFactory;
+typedef libFactory::SingleArgumentFactory<benchScaleStringBase, int> benchScaleSingleArgStringFactory;
+
+/**
+ * @brief the ids first to first + count - 1 of an id type, shuffled so lookups do not walk the registry in order
+ */
+template<class identifierType>
+static std::vector<identifierType> benchScaleIDs(std::size_t first, std::size_t count){
+    std::vector<identifierType> ids;
+    ids.reserve(count);
+    for (std::size_t i = first; i < first + count; i++){
+        if constexpr (std::is_same_v<identifierType, std::string>){
+            ids.push_back("object_" + std::to_string(i));
+        }else{
+            ids.push_back(static_cast<identifierType>(i));
+        }
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(42));
+    return ids;
+}
+
+template<class factory, class identifierType>
+static bool benchScaleRegister(const identifierType& id){
+    if constexpr (requires { factory::create(id, 1); }){
+        return factory::template registerObjectConstructor<benchScaleObject<typename factory::baseType>>(id);
+    }else{
+        return factory::template registerObject<benchScaleObject<typename factory::baseType>>(id);
+    }
+}
+
+template<class factory, class identifierType>
+static auto benchScaleCreate(const identifierType& id){
+    if constexpr (requires { factory::create(id, 1); }){
+        return factory::create(id, 1);
+    }else{
+        return factory::create(id);
+    }
+}
+
+/**
+ * @brief adds the base class to a factory so the helpers above can name the registered object
+ */
+template<class factory, class base>
+struct benchScaleFactory: public factory{
+    typedef base baseType;
+    typedef typename base::__factoryIdentifierType__ identifierType;
+};
+
+typedef benchScaleFactory<benchScaleBasicIntFactory, benchScaleIntBase> benchScaleBasicInt;
+typedef benchScaleFactory<benchScaleBasicStringFactory, benchScaleStringBase> benchScaleBasicString;
+typedef benchScaleFactory<benchScaleSingleArgIntFactory, benchScaleIntBase> benchScaleSingleArgInt;
+typedef benchScaleFactory<benchScaleSingleArgStringFactory, benchScaleStringBase> benchScaleSingleArgString;
+
+template<class factory>
+static void benchScaleFill(const benchmark::State& state){
+    factory::clearRegistry();
+    for (const auto& id : benchScaleIDs<typename factory::identifierType>(0, static_cast<std::size_t>(state.range(0)))){
+        benchScaleRegister<factory>(id);
+    }
+}
+
+template<class factory>
+static void benchScaleClear(const benchmark::State&){
+    factory::clearRegistry();
+}
+
+template<class factory>
+static void BM_scaleCreateHit(benchmark::State& state){
+    auto ids = benchScaleIDs<typename factory::identifierType>(0, static_cast<std::size_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchScaleCreate<factory>(ids[i]));
+        if (++i == ids.size()){
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class factory>
+static void BM_scaleCreateMiss(benchmark::State& state){
+    auto ids = benchScaleIDs<typename factory::identifierType>(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchScaleCreate<factory>(ids[i]));
+        if (++i == ids.size()){
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// registers range(0) ids into an empty registry, the clearRegistry() that empties it again is part of the measurement
+template<class factory>
+static void BM_scaleRegister(benchmark::State& state){
+    auto ids = benchScaleIDs<typename factory::identifierType>(0, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state){
+        for (const auto& id : ids){
+            benchmark::DoNotOptimize(benchScaleRegister<factory>(id));
+        }
+        factory::clearRegistry();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// registers and removes one id while the registry holds range(0) other ids
+template<class factory>
+static void BM_scaleChurn(benchmark::State& state){
+    auto ids = benchScaleIDs<typename factory::identifierType>(static_cast<std::size_t>(state.range(0)), 1024);
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchScaleRegister<factory>(ids[i]));
+        benchmark::DoNotOptimize(factory::removeCreatorFunc(ids[i]));
+        i = (i + 1) & 1023;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define LIBFACTORY_SCALE_BENCHMARKS(factory) \
+    BENCHMARK_TEMPLATE(BM_scaleCreateHit, factory)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchScaleFill<factory>)->Teardown(benchScaleClear<factory>); \
+    BENCHMARK_TEMPLATE(BM_scaleCreateMiss, factory)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchScaleFill<factory>)->Teardown(benchScaleClear<factory>); \
+    BENCHMARK_TEMPLATE(BM_scaleCreateHit, factory)->Arg(1000)->ThreadRange(1, 8)->UseRealTime()->Setup(benchScaleFill<factory>)->Teardown(benchScaleClear<factory>); \
+    BENCHMARK_TEMPLATE(BM_scaleRegister, factory)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchScaleClear<factory>); \
+    BENCHMARK_TEMPLATE(BM_scaleChurn, factory)->RangeMultiplier(10)->Range(10, 100000)->Setup(benchScaleFill<factory>)->Teardown(benchScaleClear<factory>)
+
+LIBFACTORY_SCALE_BENCHMARKS(benchScaleBasicInt);
+LIBFACTORY_SCALE_BENCHMARKS(benchScaleBasicString);
+LIBFACTORY_SCALE_BENCHMARKS(benchScaleSingleArgInt);
+LIBFACTORY_SCALE_BENCHMARKS(benchScaleSingleArgString);
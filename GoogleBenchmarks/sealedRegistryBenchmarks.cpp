@@ -0,0 +1,60 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+struct benchSealBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchSealBase() = default;
+    int a = 0;
+};
+
+struct benchSealDeriv: public benchSealBase{
+};
+
+typedef libFactory::BasicFactory<benchSealBase> benchSealFactory;
+
+/**
+ * @brief registers state.range(0) ids with the factory and returns a shuffled list of them to look up
+ */
+static std::vector<int> setupSealRegistry(benchmark::State& state, bool seal){
+    benchSealFactory::clearRegistry();
+    std::vector<int> ids;
+    for (int i = 0; i < state.range(0); i++){
+        ids.push_back(i * 7919);
+        benchSealFactory::registerObject<benchSealDeriv>(ids.back());
+    }
+    if (seal){
+        benchSealFactory::seal();
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(42));
+    return ids;
+}
+
+static void BM_createUnsealed(benchmark::State& state){
+    auto ids = setupSealRegistry(state, false);
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchSealFactory::create(ids[i]));
+        i = i + 1 == ids.size() ? 0 : i + 1;
+    }
+    benchSealFactory::clearRegistry();
+}
+BENCHMARK(BM_createUnsealed)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_createSealed(benchmark::State& state){
+    auto ids = setupSealRegistry(state, true);
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchSealFactory::create(ids[i]));
+        i = i + 1 == ids.size() ? 0 : i + 1;
+    }
+    benchSealFactory::clearRegistry();
+}
+BENCHMARK(BM_createSealed)->Arg(10)->Arg(1000)->Arg(100000);
@@ -0,0 +1,81 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+#include "allocationCounter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+// holds state.range(0) references to 8 immutable strategy objects, once as an object per reference with create() and once as shared instances with createShared()
+
+struct benchSharedBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchSharedBase() = default;
+};
+
+template<int id>
+struct benchSharedStrategy: public benchSharedBase{
+    std::array<double, 16> coefficients{};
+};
+
+typedef libFactory::BasicFactory<benchSharedBase> benchSharedFactory;
+
+template<int... ids>
+static void benchSharedRegister(std::integer_sequence<int, ids...>){
+    (benchSharedFactory::registerObject<benchSharedStrategy<ids>>(ids), ...);
+}
+
+static void benchSharedSetup(const benchmark::State&){
+    benchSharedRegister(std::make_integer_sequence<int, 8>());
+}
+
+static void benchSharedTeardown(const benchmark::State&){
+    benchSharedFactory::clearSharedInstances();
+    benchSharedFactory::clearRegistry();
+}
+
+template<class referenceType, class function>
+static void benchSharedHold(benchmark::State& state, function&& make){
+    std::size_t bytes = 0;
+    std::size_t allocations = 0;
+    for (auto _ : state){
+        std::size_t bytesBefore = allocationCounter::bytesInUse();
+        std::size_t allocationsBefore = allocationCounter::allocations();
+        std::vector<referenceType> references;
+        references.reserve(static_cast<std::size_t>(state.range(0)));
+        for (std::int64_t i = 0; i < state.range(0); i++){
+            references.push_back(make(static_cast<int>(i % 8)));
+        }
+        bytes = allocationCounter::bytesInUse() - bytesBefore;
+        allocations = allocationCounter::allocations() - allocationsBefore;
+        benchmark::DoNotOptimize(references.data());
+    }
+    state.counters["bytesPerReference"] = benchmark::Counter(static_cast<double>(bytes) / static_cast<double>(state.range(0)));
+    state.counters["allocsPerReference"] = benchmark::Counter(static_cast<double>(allocations) / static_cast<double>(state.range(0)));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_holdCreated(benchmark::State& state){
+    benchSharedHold<std::unique_ptr<benchSharedBase>>(state, [](int id){ return benchSharedFactory::create(id); });
+}
+BENCHMARK(BM_holdCreated)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMillisecond)->Setup(benchSharedSetup)->Teardown(benchSharedTeardown);
+
+static void BM_holdShared(benchmark::State& state){
+    benchSharedHold<std::shared_ptr<const benchSharedBase>>(state, [](int id){ return benchSharedFactory::createShared(id); });
+}
+BENCHMARK(BM_holdShared)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMillisecond)->Setup(benchSharedSetup)->Teardown(benchSharedTeardown);
+
+// cost of a createShared() call on a cached instance from multiple threads
+static void BM_createSharedCached(benchmark::State& state){
+    int id = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchSharedFactory::createShared(id));
+        id = (id + 1) % 8;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_createSharedCached)->ThreadRange(1, 8)->UseRealTime()->Setup(benchSharedSetup)->Teardown(benchSharedTeardown);
@@ -0,0 +1,92 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+struct benchStatefulBase{
+    typedef int __factoryIdentifierType__;
+    explicit benchStatefulBase(int a) : a(a) {}
+    virtual ~benchStatefulBase() = default;
+    int a;
+};
+
+/**
+ * @brief factory with the old creator storage, a bare function pointer per id
+ */
+class benchFunctionPointerFactory: public libFactory::FactoryBase<benchStatefulBase, benchStatefulBase* (*)(void)>{
+public:
+    static benchStatefulBase* create(int id){
+        if (auto entry = findEntry(id)){
+            return entry->creator();
+        }
+        return nullptr;
+    }
+};
+
+// raw pointers to a static object so the creator call itself is what gets measured
+typedef libFactory::BasicFactory<benchStatefulBase, int, benchStatefulBase*> benchInplaceFactory;
+
+static benchStatefulBase benchStatefulInstance(0);
+
+struct benchStatefulConfig{
+    benchStatefulBase* instance;
+    int offset;
+};
+
+static bool registerStatefulBenchCreators(){
+    benchFunctionPointerFactory::registerCreatorFunc(1, [](){ return &benchStatefulInstance; });
+    benchInplaceFactory::registerCreatorFunc(1, [](){ return &benchStatefulInstance; });
+    auto config = std::make_shared<benchStatefulConfig>(benchStatefulConfig{&benchStatefulInstance, 1});
+    benchInplaceFactory::registerCreatorFunc(2, [config](){ config->instance->a = config->offset; return config->instance; });
+    benchStatefulConfig plainConfig{&benchStatefulInstance, 2};
+    benchInplaceFactory::registerCreatorFunc(3, [plainConfig](){ plainConfig.instance->a = plainConfig.offset; return plainConfig.instance; });
+    return true;
+}
+static const bool statefulBenchCreatorsRegistered = registerStatefulBenchCreators();
+
+static void BM_createFunctionPointer(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchFunctionPointerFactory::create(1));
+    }
+}
+BENCHMARK(BM_createFunctionPointer);
+
+static void BM_createInplaceStateless(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchInplaceFactory::create(1));
+    }
+}
+BENCHMARK(BM_createInplaceStateless);
+
+static void BM_createInplaceSharedState(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchInplaceFactory::create(2));
+    }
+}
+BENCHMARK(BM_createInplaceSharedState);
+
+static void BM_createInplaceCapturedValue(benchmark::State& state){
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchInplaceFactory::create(3));
+    }
+}
+BENCHMARK(BM_createInplaceCapturedValue);
+
+// creating real objects, where the creator call is only a small part of the cost
+typedef libFactory::BasicFactory<benchStatefulBase> benchStatefulObjectFactory;
+
+static void BM_createObjectStateful(benchmark::State& state){
+    if (state.thread_index() == 0){
+        benchStatefulObjectFactory::clearRegistry();
+        int offset = 4;
+        benchStatefulObjectFactory::registerCreatorFunc(1, [offset](){ return std::make_unique<benchStatefulBase>(offset); });
+    }
+    for (auto _ : state){
+        benchmark::DoNotOptimize(benchStatefulObjectFactory::create(1));
+    }
+}
+BENCHMARK(BM_createObjectStateful);
@@ -0,0 +1,95 @@
+//
+// Created by elias on 16/10/2026.
+//
+#ifndef LIBFACTORY_STATICREGISTRATIONBENCHMARKTYPES_H
+#define LIBFACTORY_STATICREGISTRATIONBENCHMARKTYPES_H
+
+#include "../libFactory.h"
+
+#include <memory>
+#include <utility>
+
+// ~5k generated object types that are registered with autoRegister and staticRegister,
+// the types are split into blocks that are instantiated in their own translation units (staticRegistrationTypes<block>.cpp) to keep the compile time down
+
+constexpr std::size_t benchStartupBlockSize = 1000;
+constexpr std::size_t benchStartupBlockCount = 5;
+constexpr std::size_t benchStartupTypeCount = benchStartupBlockSize * benchStartupBlockCount;
+
+struct benchStartupBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~benchStartupBase() = default;
+};
+
+/**
+ * @brief factory that makes the registration internals available to the replay
+ */
+template<template<class, class> class registryStorage, int tag>
+struct benchStartupFactory: public libFactory::BasicFactory<benchStartupBase, int, std::unique_ptr<benchStartupBase>, registryStorage>{
+    typedef libFactory::BasicFactory<benchStartupBase, int, std::unique_ptr<benchStartupBase>, registryStorage> factoryType;
+    using factoryType::registerObjectEntry;
+    using factoryType::linkRegistration;
+};
+
+// the tag gives both mechanisms their own registry
+typedef benchStartupFactory<libFactory::FlatStorage, 0> benchStartupAutoFactory;
+typedef benchStartupFactory<libFactory::FlatStorage, 1> benchStartupStaticFactory;
+
+template<std::size_t index>
+struct benchStartupObject: public benchStartupBase, libFactory::autoRegister<benchStartupAutoFactory, benchStartupObject<index>>, libFactory::staticRegister<benchStartupStaticFactory, benchStartupObject<index>>{
+    benchStartupObject() {
+        static_cast<void>(libFactory::autoRegister<benchStartupAutoFactory, benchStartupObject>::libFactory_bRegistered);
+        static_cast<void>(libFactory::staticRegister<benchStartupStaticFactory, benchStartupObject>::libFactory_bRegistered);
+    }
+    static int getFactoryID(){ return static_cast<int>(index); }
+    static std::unique_ptr<benchStartupBase> create(){ return std::unique_ptr<benchStartupBase>(new benchStartupObject()); }
+
+    // what autoRegister does for the type at static init time
+    static void autoRegistration(){
+        benchStartupAutoFactory::template registerObjectEntry<benchStartupObject>(getFactoryID(), create);
+    }
+
+    // what staticRegister does for the type at static init time
+    static void staticRegistration(){
+        benchStartupStaticFactory::linkRegistration(libFactory::staticRegister<benchStartupStaticFactory, benchStartupObject>::libFactory_registration);
+    }
+};
+
+template<std::size_t block, std::size_t... indices>
+void benchStartupAutoRegistration(std::index_sequence<indices...>){
+    (benchStartupObject<block * benchStartupBlockSize + indices>::autoRegistration(), ...);
+}
+
+template<std::size_t block, std::size_t... indices>
+void benchStartupStaticRegistration(std::index_sequence<indices...>){
+    (benchStartupObject<block * benchStartupBlockSize + indices>::staticRegistration(), ...);
+}
+
+/**
+ * @brief replays the autoRegister static init of all types of a block
+ */
+template<std::size_t block>
+void benchStartupAutoRegistrationBlock(){
+    benchStartupAutoRegistration<block>(std::make_index_sequence<benchStartupBlockSize>());
+}
+
+/**
+ * @brief replays the staticRegister static init of all types of a block
+ */
+template<std::size_t block>
+void benchStartupStaticRegistrationBlock(){
+    benchStartupStaticRegistration<block>(std::make_index_sequence<benchStartupBlockSize>());
+}
+
+extern template void benchStartupAutoRegistrationBlock<0>();
+extern template void benchStartupAutoRegistrationBlock<1>();
+extern template void benchStartupAutoRegistrationBlock<2>();
+extern template void benchStartupAutoRegistrationBlock<3>();
+extern template void benchStartupAutoRegistrationBlock<4>();
+extern template void benchStartupStaticRegistrationBlock<0>();
+extern template void benchStartupStaticRegistrationBlock<1>();
+extern template void benchStartupStaticRegistrationBlock<2>();
+extern template void benchStartupStaticRegistrationBlock<3>();
+extern template void benchStartupStaticRegistrationBlock<4>();
+
+#endif //LIBFACTORY_STATICREGISTRATIONBENCHMARKTYPES_H
@@ -0,0 +1,63 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "staticRegistrationBenchmarkTypes.h"
+
+#include <benchmark/benchmark.h>
+
+// the benchmarks replay the registration work autoRegister and staticRegister do at static init time, the real static init runs before main() and can not be timed here
+
+template<std::size_t... blocks>
+static void benchStartupAutoRegistrationBlocks(std::index_sequence<blocks...>){
+    (benchStartupAutoRegistrationBlock<blocks>(), ...);
+}
+
+template<std::size_t... blocks>
+static void benchStartupStaticRegistrationBlocks(std::index_sequence<blocks...>){
+    (benchStartupStaticRegistrationBlock<blocks>(), ...);
+}
+
+// the static init part of autoRegister, every type is inserted into the registry
+static void BM_startupAutoRegister(benchmark::State& state){
+    for (auto _ : state){
+        benchStartupAutoFactory::clearRegistry();
+        benchStartupAutoRegistrationBlocks(std::make_index_sequence<benchStartupBlockCount>());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(benchStartupTypeCount));
+}
+BENCHMARK(BM_startupAutoRegister)->Unit(benchmark::kMicrosecond);
+
+// the static init part of staticRegister, every type only links its node
+static void BM_startupStaticRegister(benchmark::State& state){
+    for (auto _ : state){
+        state.PauseTiming();
+        // adds the nodes of the last iteration to the registry before clearing it, a node may only be linked again once it is no longer pending
+        benchStartupStaticFactory::clearRegistry();
+        state.ResumeTiming();
+        benchStartupStaticRegistrationBlocks(std::make_index_sequence<benchStartupBlockCount>());
+    }
+    benchStartupStaticFactory::clearRegistry();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(benchStartupTypeCount));
+}
+BENCHMARK(BM_startupStaticRegister)->Unit(benchmark::kMicrosecond);
+
+// startup and the first create() together, staticRegister builds the registry in one bulk insert on first use
+static void BM_startupAutoRegisterFirstCreate(benchmark::State& state){
+    for (auto _ : state){
+        benchStartupAutoFactory::clearRegistry();
+        benchStartupAutoRegistrationBlocks(std::make_index_sequence<benchStartupBlockCount>());
+        benchmark::DoNotOptimize(benchStartupAutoFactory::create(0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(benchStartupTypeCount));
+}
+BENCHMARK(BM_startupAutoRegisterFirstCreate)->Unit(benchmark::kMicrosecond);
+
+static void BM_startupStaticRegisterFirstCreate(benchmark::State& state){
+    for (auto _ : state){
+        benchStartupStaticFactory::clearRegistry();
+        benchStartupStaticRegistrationBlocks(std::make_index_sequence<benchStartupBlockCount>());
+        benchmark::DoNotOptimize(benchStartupStaticFactory::create(0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(benchStartupTypeCount));
+}
+BENCHMARK(BM_startupStaticRegisterFirstCreate)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,7 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "staticRegistrationBenchmarkTypes.h"
+
+template void benchStartupAutoRegistrationBlock<1>();
+template void benchStartupStaticRegistrationBlock<1>();
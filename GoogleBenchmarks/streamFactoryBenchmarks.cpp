@@ -0,0 +1,109 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactoryStream.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// rebuilds 100000 objects with a 64 byte payload each from a record file, every benchmark iteration reads the whole file
+
+struct benchStreamBase{
+    typedef int __factoryIdentifierType__;
+    explicit benchStreamBase(std::span<const std::byte> payload){
+        std::memcpy(data.data(), payload.data(), std::min(payload.size(), data.size()));
+    }
+    virtual ~benchStreamBase() = default;
+    std::array<std::byte, 64> data{};
+};
+
+template<int id>
+struct benchStreamObject: public benchStreamBase{
+    using benchStreamBase::benchStreamBase;
+};
+
+typedef libFactory::StreamFactory<libFactory::SingleArgumentFactory<benchStreamBase, std::span<const std::byte>>> benchStreamFactory;
+
+constexpr int benchStreamRecordCount = 100000;
+
+static std::string benchStreamPath(){
+    return (std::filesystem::temp_directory_path() / ("libFactoryStreamBenchmarks" + std::to_string(::getpid()) + ".records")).string();
+}
+
+template<int... ids>
+static void benchStreamRegister(std::integer_sequence<int, ids...>){
+    (benchStreamFactory::registerObjectConstructor<benchStreamObject<ids>>(ids), ...);
+}
+
+static void benchStreamSetup(const benchmark::State&){
+    benchStreamRegister(std::make_integer_sequence<int, 8>());
+    libFactory::RecordWriter<int> writer(benchStreamPath());
+    std::array<std::byte, 64> payload{};
+    for (int i = 0; i < benchStreamRecordCount; i++){
+        payload[0] = static_cast<std::byte>(i);
+        writer.write(i % 8, payload);
+    }
+    writer.close();
+}
+
+static void benchStreamTeardown(const benchmark::State&){
+    benchStreamFactory::clearRegistry();
+    std::filesystem::remove(benchStreamPath());
+}
+
+// reads every record into a freshly allocated buffer and then creates the object from it
+static void BM_streamReadThenCreate(benchmark::State& state){
+    std::string path = benchStreamPath();
+    for (auto _ : state){
+        std::vector<std::unique_ptr<benchStreamBase>> objects;
+        objects.reserve(benchStreamRecordCount);
+        std::ifstream file(path, std::ios::binary);
+        libFactory::RecordHeader header{};
+        while (file.read(reinterpret_cast<char*>(&header), sizeof(header))){
+            int id = 0;
+            std::vector<std::byte> payload(header.payloadSize);
+            file.read(reinterpret_cast<char*>(&id), sizeof(id));
+            file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            objects.push_back(benchStreamFactory::create(id, payload));
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * benchStreamRecordCount);
+}
+BENCHMARK(BM_streamReadThenCreate)->Unit(benchmark::kMillisecond)->Setup(benchStreamSetup)->Teardown(benchStreamTeardown);
+
+// maps the file and creates the objects while iterating it
+static void BM_streamMappedIteration(benchmark::State& state){
+    std::string path = benchStreamPath();
+    for (auto _ : state){
+        std::vector<std::unique_ptr<benchStreamBase>> objects;
+        objects.reserve(benchStreamRecordCount);
+        for (auto object : benchStreamFactory::readRecords(path)){
+            objects.push_back(std::move(object));
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * benchStreamRecordCount);
+}
+BENCHMARK(BM_streamMappedIteration)->Unit(benchmark::kMillisecond)->Setup(benchStreamSetup)->Teardown(benchStreamTeardown);
+
+// maps the file and creates the objects in state.range(0) chunks on as many threads
+static void BM_streamMappedCreateAll(benchmark::State& state){
+    std::string path = benchStreamPath();
+    for (auto _ : state){
+        auto objects = benchStreamFactory::readRecords(path).createAll(static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * benchStreamRecordCount);
+}
+BENCHMARK(BM_streamMappedCreateAll)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond)->Setup(benchStreamSetup)->Teardown(benchStreamTeardown);
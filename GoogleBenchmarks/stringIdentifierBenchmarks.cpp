@@ -0,0 +1,77 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+#include "allocationCounter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+struct benchStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~benchStringBase() = default;
+};
+
+// the creator hands out a static object so that only the lookup itself can allocate
+typedef libFactory::BasicFactory<benchStringBase, std::string, benchStringBase*> benchStringMapFactory;
+typedef libFactory::BasicFactory<benchStringBase, std::string, benchStringBase*, libFactory::HashStorage> benchStringHashFactory;
+
+static benchStringBase* benchStringInstance(){
+    static benchStringBase instance;
+    return &instance;
+}
+
+static std::vector<std::string> benchStringIDs(std::size_t length){
+    std::vector<std::string> ids;
+    for (int i = 0; i < 64; i++){
+        std::string id = "handler_" + std::to_string(i) + "_";
+        id.resize(std::max(length, id.size()), 'x');
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+template<class factory>
+static void BM_createFromLiteral(benchmark::State& state){
+    factory::clearRegistry();
+    auto ids = benchStringIDs(state.range(0));
+    for (const auto& id : ids){
+        factory::registerCreatorFunc(id, &benchStringInstance);
+    }
+    std::vector<const char*> literals;
+    for (const auto& id : ids){
+        literals.push_back(id.c_str());
+    }
+
+    std::size_t allocations = allocationCounter::allocations();
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(literals[i++ & 63]));
+    }
+    state.counters["allocsPerCreate"] = benchmark::Counter(static_cast<double>(allocationCounter::allocations() - allocations) / static_cast<double>(state.iterations()));
+    factory::clearRegistry();
+}
+BENCHMARK_TEMPLATE(BM_createFromLiteral, benchStringMapFactory)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_TEMPLATE(BM_createFromLiteral, benchStringHashFactory)->Arg(8)->Arg(32)->Arg(128);
+
+// what every create("...") used to cost: materializing a std::string key per call
+template<class factory>
+static void BM_createFromTemporaryString(benchmark::State& state){
+    factory::clearRegistry();
+    auto ids = benchStringIDs(state.range(0));
+    for (const auto& id : ids){
+        factory::registerCreatorFunc(id, &benchStringInstance);
+    }
+
+    std::size_t allocations = allocationCounter::allocations();
+    std::size_t i = 0;
+    for (auto _ : state){
+        benchmark::DoNotOptimize(factory::create(std::string(ids[i++ & 63].c_str())));
+    }
+    state.counters["allocsPerCreate"] = benchmark::Counter(static_cast<double>(allocationCounter::allocations() - allocations) / static_cast<double>(state.iterations()));
+    factory::clearRegistry();
+}
+BENCHMARK_TEMPLATE(BM_createFromTemporaryString, benchStringMapFactory)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_TEMPLATE(BM_createFromTemporaryString, benchStringHashFactory)->Arg(8)->Arg(32)->Arg(128);
@@ -0,0 +1,127 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+struct testCopyCounter{
+    testCopyCounter() = default;
+    testCopyCounter(const testCopyCounter&) { copies++; }
+    testCopyCounter(testCopyCounter&&) noexcept { moves++; }
+    testCopyCounter& operator=(const testCopyCounter&) { copies++; return *this; }
+    testCopyCounter& operator=(testCopyCounter&&) noexcept { moves++; return *this; }
+
+    static void reset(){ copies = 0; moves = 0; }
+    static inline int copies = 0;
+    static inline int moves = 0;
+};
+
+struct testArgBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~testArgBase() = default;
+    virtual int value(){return 0;}
+};
+
+struct testArgCounter: public testArgBase{
+    testArgCounter(testCopyCounter counter, int a) : counter(std::move(counter)), a(a) {}
+    int value() override {return a;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+    testCopyCounter counter;
+    int a;
+};
+
+struct testArgMoveOnly: public testArgBase{
+    testArgMoveOnly(std::unique_ptr<int> ptr, int& out) : ptr(std::move(ptr)) { out = *this->ptr; }
+    int value() override {return *ptr;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+    std::unique_ptr<int> ptr;
+};
+
+struct testArgReference: public testArgBase{
+    testArgReference(const testCopyCounter& counter, std::string&& name) : counter(&counter), name(std::move(name)) {}
+    int value() override {return static_cast<int>(name.size());}
+    static __factoryIdentifierType__ getFactoryID(){return 3;}
+    const testCopyCounter* counter;
+    std::string name;
+};
+
+typedef libFactory::ArgumentFactory<testArgBase, std::unique_ptr<testArgBase>(testCopyCounter, int)> testArgValueFactory;
+typedef libFactory::ArgumentFactory<testArgBase, std::unique_ptr<testArgBase>(std::unique_ptr<int>, int&)> testArgMoveOnlyFactory;
+typedef libFactory::ArgumentFactory<testArgBase, std::unique_ptr<testArgBase>(const testCopyCounter&, std::string&&)> testArgReferenceFactory;
+typedef libFactory::ArgumentFactory<testArgBase, libFactory::FactoryPtr<testArgBase>(testCopyCounter, int)> testArgPooledFactory;
+
+class argumentFactoryTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testArgValueFactory::registerObjectConstructor<testArgCounter>());
+        ASSERT_TRUE(testArgMoveOnlyFactory::registerObjectConstructor<testArgMoveOnly>());
+        ASSERT_TRUE(testArgReferenceFactory::registerObjectConstructor<testArgReference>());
+        ASSERT_TRUE(testArgPooledFactory::registerPooledObjectConstructor<testArgCounter>());
+        testCopyCounter::reset();
+    }
+
+    void TearDown() override {
+        testArgValueFactory::clearRegistry();
+        testArgMoveOnlyFactory::clearRegistry();
+        testArgReferenceFactory::clearRegistry();
+        testArgPooledFactory::clearRegistry();
+    }
+};
+
+TEST_F(argumentFactoryTests, createObjects){
+    auto ret = testArgValueFactory::create(testArgCounter::getFactoryID(), testCopyCounter(), 5);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 5);
+    ASSERT_EQ(testArgValueFactory::create(testArgMoveOnly::getFactoryID(), testCopyCounter(), 5), nullptr);
+}
+
+TEST_F(argumentFactoryTests, rvalueArgumentNotCopied){
+    auto ret = testArgValueFactory::create(testArgCounter::getFactoryID(), testCopyCounter(), 1);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(testCopyCounter::copies, 0);
+}
+
+TEST_F(argumentFactoryTests, lvalueArgumentCopiedOnce){
+    testCopyCounter counter;
+    auto ret = testArgValueFactory::create(testArgCounter::getFactoryID(), counter, 1);
+    ASSERT_NE(ret, nullptr);
+    // the by value signature needs exactly one copy, everything after that is moved
+    ASSERT_EQ(testCopyCounter::copies, 1);
+}
+
+TEST_F(argumentFactoryTests, moveOnlyArgument){
+    int out = 0;
+    auto ret = testArgMoveOnlyFactory::create(testArgMoveOnly::getFactoryID(), std::make_unique<int>(7), out);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 7);
+    ASSERT_EQ(out, 7);
+}
+
+TEST_F(argumentFactoryTests, referenceArguments){
+    testCopyCounter counter;
+    std::string name = "reference";
+    auto ret = testArgReferenceFactory::create(testArgReference::getFactoryID(), counter, std::move(name));
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 9);
+    ASSERT_EQ(static_cast<testArgReference*>(ret.get())->counter, &counter);
+    ASSERT_EQ(testCopyCounter::copies, 0);
+    ASSERT_EQ(testCopyCounter::moves, 0);
+}
+
+TEST_F(argumentFactoryTests, pooledArgumentNotCopied){
+    auto ret = testArgPooledFactory::create(testArgCounter::getFactoryID(), testCopyCounter(), 3);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 3);
+    ASSERT_EQ(testCopyCounter::copies, 0);
+}
+
+TEST_F(argumentFactoryTests, removeRegistrations){
+    ASSERT_TRUE(testArgValueFactory::removeCreatorFunc(testArgCounter::getFactoryID()));
+    ASSERT_EQ(testArgValueFactory::create(testArgCounter::getFactoryID(), testCopyCounter(), 1), nullptr);
+    ASSERT_TRUE(testArgValueFactory::registerObjectConstructor<testArgCounter>(5));
+    ASSERT_NE(testArgValueFactory::create(5, testCopyCounter(), 1), nullptr);
+}
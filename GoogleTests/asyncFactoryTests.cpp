@@ -0,0 +1,225 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactoryAsync.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <coroutine>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+struct testAsyncBase{
+    typedef int __factoryIdentifierType__;
+    testAsyncBase() = default;
+    explicit testAsyncBase(int a) : a(a) {}
+    virtual ~testAsyncBase() = default;
+    int a = 0;
+};
+
+struct testAsyncObject: public testAsyncBase{
+    explicit testAsyncObject(int a) : testAsyncBase(a) {}
+    static int getFactoryID(){ return 1; }
+};
+
+struct testAsyncThrowing: public testAsyncBase{
+    explicit testAsyncThrowing(int) { throw std::runtime_error("testAsyncThrowing"); }
+    static int getFactoryID(){ return 2; }
+};
+
+struct testAsyncSlow: public testAsyncBase{
+    explicit testAsyncSlow(int a) : testAsyncBase(a) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }
+    static int getFactoryID(){ return 3; }
+};
+
+typedef libFactory::AsyncFactory<libFactory::SingleArgumentFactory<testAsyncBase, int>> testAsyncFactory;
+
+// the arguments in the order the recording creator was called
+static std::mutex testAsyncRecordMutex;
+static std::vector<int> testAsyncRecord;
+
+constexpr int testAsyncRecordingID = 4;
+
+/**
+ * @brief minimal fire and forget coroutine type, the coroutine runs until its first suspension when it is called
+ */
+struct testAsyncTask{
+    struct promise_type{
+        testAsyncTask get_return_object(){ return {}; }
+        std::suspend_never initial_suspend(){ return {}; }
+        std::suspend_never final_suspend() noexcept{ return {}; }
+        void return_void(){}
+        void unhandled_exception(){ std::terminate(); }
+    };
+};
+
+static testAsyncTask testAsyncAwait(int id, int a, std::promise<int>& result){
+    try{
+        auto object = co_await testAsyncFactory::createAsync(id, a);
+        result.set_value(object ? object->a : -1);
+    }catch (const std::runtime_error&){
+        result.set_value(-2);
+    }
+}
+
+class asyncFactoryTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testAsyncFactory::registerObjectConstructor<testAsyncObject>());
+        ASSERT_TRUE(testAsyncFactory::registerObjectConstructor<testAsyncThrowing>());
+        ASSERT_TRUE(testAsyncFactory::registerObjectConstructor<testAsyncSlow>());
+        ASSERT_TRUE(testAsyncFactory::registerCreatorFunc(testAsyncRecordingID, [](int a) -> std::unique_ptr<testAsyncBase>{
+            std::lock_guard<std::mutex> lock(testAsyncRecordMutex);
+            testAsyncRecord.push_back(a);
+            return std::make_unique<testAsyncBase>(a);
+        }));
+        testAsyncRecord.clear();
+    }
+
+    void TearDown() override {
+        testAsyncFactory::setWorkerCount(0);
+        testAsyncFactory::clearPrewarmed();
+        testAsyncFactory::clearRegistry();
+    }
+};
+
+TEST_F(asyncFactoryTests, createAsync){
+    auto result = testAsyncFactory::createAsync(testAsyncObject::getFactoryID(), 5);
+    ASSERT_TRUE(result.valid());
+    auto object = result.get();
+    ASSERT_NE(object, nullptr);
+    ASSERT_EQ(object->a, 5);
+
+    auto missing = testAsyncFactory::createAsync(100, 5);
+    ASSERT_EQ(missing.get(), nullptr);
+
+    ASSERT_FALSE(testAsyncFactory::resultType().valid());
+    ASSERT_FALSE(testAsyncFactory::resultType().ready());
+}
+
+TEST_F(asyncFactoryTests, exceptionPropagation){
+    auto result = testAsyncFactory::createAsync(testAsyncThrowing::getFactoryID(), 0);
+    result.wait();
+    ASSERT_TRUE(result.ready());
+    ASSERT_THROW(result.get(), std::runtime_error);
+
+    // the pool keeps working after a creator threw
+    ASSERT_EQ(testAsyncFactory::createAsync(testAsyncObject::getFactoryID(), 1).get()->a, 1);
+
+    // creations that throw do not end up in the ready queue
+    ASSERT_TRUE(testAsyncFactory::prewarm(testAsyncThrowing::getFactoryID(), 2, 0));
+    testAsyncFactory::shutdown();
+    ASSERT_EQ(testAsyncFactory::getPrewarmedCount(testAsyncThrowing::getFactoryID()), 0);
+}
+
+TEST_F(asyncFactoryTests, coroutineAwait){
+    std::promise<int> objectResult;
+    testAsyncAwait(testAsyncSlow::getFactoryID(), 7, objectResult);
+    ASSERT_EQ(objectResult.get_future().get(), 7);
+
+    std::promise<int> throwingResult;
+    testAsyncAwait(testAsyncThrowing::getFactoryID(), 0, throwingResult);
+    ASSERT_EQ(throwingResult.get_future().get(), -2);
+
+    std::promise<int> missingResult;
+    testAsyncAwait(100, 0, missingResult);
+    ASSERT_EQ(missingResult.get_future().get(), -1);
+}
+
+TEST_F(asyncFactoryTests, singleWorkerOrdering){
+    testAsyncFactory::setWorkerCount(1);
+    std::vector<testAsyncFactory::resultType> results;
+    for (int i = 0; i < 100; i++){
+        results.push_back(testAsyncFactory::createAsync(testAsyncRecordingID, i));
+    }
+    for (int i = 0; i < 100; i++){
+        ASSERT_EQ(results[static_cast<std::size_t>(i)].get()->a, i);
+    }
+    std::vector<int> expected;
+    for (int i = 0; i < 100; i++){
+        expected.push_back(i);
+    }
+    ASSERT_EQ(testAsyncRecord, expected);
+}
+
+TEST_F(asyncFactoryTests, prewarm){
+    ASSERT_FALSE(testAsyncFactory::prewarm(100, 3, 0));
+
+    ASSERT_TRUE(testAsyncFactory::prewarm(testAsyncRecordingID, 3, 7));
+    testAsyncFactory::shutdown();
+    ASSERT_EQ(testAsyncFactory::getPrewarmedCount(testAsyncRecordingID), 3);
+    ASSERT_EQ(testAsyncRecord.size(), 3);
+
+    // create() drains the ready queue first without calling the creator, then falls back to the creator
+    for (int i = 0; i < 3; i++){
+        ASSERT_EQ(testAsyncFactory::create(testAsyncRecordingID, 99)->a, 7);
+    }
+    ASSERT_EQ(testAsyncRecord.size(), 3);
+    ASSERT_EQ(testAsyncFactory::getPrewarmedCount(testAsyncRecordingID), 0);
+    ASSERT_EQ(testAsyncFactory::create(testAsyncRecordingID, 99)->a, 99);
+    ASSERT_EQ(testAsyncRecord.size(), 4);
+
+    // createAsync() takes prewarmed objects as well
+    ASSERT_TRUE(testAsyncFactory::prewarm(testAsyncObject::getFactoryID(), 1, 8));
+    testAsyncFactory::shutdown();
+    ASSERT_EQ(testAsyncFactory::createAsync(testAsyncObject::getFactoryID(), 1).get()->a, 8);
+    ASSERT_EQ(testAsyncFactory::createAsync(testAsyncObject::getFactoryID(), 1).get()->a, 1);
+
+    ASSERT_TRUE(testAsyncFactory::prewarm(testAsyncObject::getFactoryID(), 2, 8));
+    testAsyncFactory::shutdown();
+    testAsyncFactory::clearPrewarmed();
+    ASSERT_EQ(testAsyncFactory::getPrewarmedCount(testAsyncObject::getFactoryID()), 0);
+    ASSERT_EQ(testAsyncFactory::create(testAsyncObject::getFactoryID(), 1)->a, 1);
+}
+
+TEST_F(asyncFactoryTests, shutdown){
+    testAsyncFactory::setWorkerCount(2);
+    std::vector<testAsyncFactory::resultType> results;
+    for (int i = 0; i < 20; i++){
+        results.push_back(testAsyncFactory::createAsync(testAsyncSlow::getFactoryID(), i));
+    }
+
+    // shutdown runs every queued creation to completion
+    testAsyncFactory::shutdown();
+    for (auto& result : results){
+        ASSERT_TRUE(result.ready());
+    }
+    for (int i = 0; i < 20; i++){
+        ASSERT_EQ(results[static_cast<std::size_t>(i)].get()->a, i);
+    }
+
+    // the next creation starts a new pool
+    ASSERT_EQ(testAsyncFactory::createAsync(testAsyncObject::getFactoryID(), 3).get()->a, 3);
+    testAsyncFactory::shutdown();
+    testAsyncFactory::shutdown();
+}
+
+TEST(workerPoolTests, stealing){
+    // one slow task must not hold up the tasks queued behind it on the same worker
+    libFactory::WorkerPool pool(2);
+    std::atomic<int> finished{0};
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    pool.submit([released](){ released.wait(); });
+    for (int i = 0; i < 10; i++){
+        pool.submit([&finished](){ finished.fetch_add(1); });
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (finished.load() != 10 && std::chrono::steady_clock::now() < deadline){
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(finished.load(), 10);
+    release.set_value();
+    pool.shutdown();
+    ASSERT_EQ(pool.workerCount(), 2);
+
+    // tasks submitted after the shutdown run on the calling thread
+    bool ran = false;
+    pool.submit([&ran](){ ran = true; });
+    ASSERT_TRUE(ran);
+}
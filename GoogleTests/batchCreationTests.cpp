@@ -0,0 +1,161 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+struct testBatchBase{
+    typedef int __factoryIdentifierType__;
+    testBatchBase() { alive++; }
+    explicit testBatchBase(int a) : a(a) { alive++; }
+    virtual ~testBatchBase() { alive--; }
+    virtual void incA(){a++;}
+    static int getFactoryID(){return 0;}
+    int a = 0;
+    static inline int alive = 0;
+};
+
+struct testBatchDerivA: public testBatchBase{
+    testBatchDerivA() = default;
+    explicit testBatchDerivA(int a) : testBatchBase(a) {}
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+};
+
+struct alignas(32) testBatchDerivB: public testBatchBase{
+    testBatchDerivB() = default;
+    explicit testBatchDerivB(int a) : testBatchBase(a) {}
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+struct testBatchThrowing: public testBatchBase{
+    testBatchThrowing(){
+        if (++constructed == 3){
+            throw std::runtime_error("third object");
+        }
+    }
+    static __factoryIdentifierType__ getFactoryID(){return 3;}
+    static inline int constructed = 0;
+};
+
+typedef libFactory::BasicFactory<testBatchBase> testBatchFactory;
+typedef libFactory::SingleArgumentFactory<testBatchBase, int> testBatchSingleArgFactory;
+
+class batchCreationTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testBatchFactory::registerObject<testBatchBase>());
+        ASSERT_TRUE(testBatchFactory::registerObject<testBatchDerivA>());
+        ASSERT_TRUE(testBatchFactory::registerObject<testBatchDerivB>());
+        ASSERT_TRUE(testBatchFactory::registerObject<testBatchThrowing>());
+        // registered without a registration helper so the object size is unknown
+        ASSERT_TRUE(testBatchFactory::registerCreatorFunc(10, [](){ return std::unique_ptr<testBatchBase>(new testBatchDerivA()); }));
+        ASSERT_TRUE(testBatchSingleArgFactory::registerObjectConstructor<testBatchDerivB>());
+        ASSERT_TRUE(testBatchSingleArgFactory::registerCreatorFunc(10, [](int a){ return std::unique_ptr<testBatchBase>(new testBatchDerivA(a)); }));
+    }
+
+    void TearDown() override {
+        testBatchFactory::clearRegistry();
+        testBatchSingleArgFactory::clearRegistry();
+    }
+};
+
+TEST_F(batchCreationTests, contiguousBatch){
+    int alive = testBatchBase::alive;
+    {
+        auto batch = testBatchFactory::createBatch(testBatchDerivA::getFactoryID(), 100);
+        ASSERT_EQ(batch.size(), 100u);
+        ASSERT_TRUE(batch.contiguous());
+        ASSERT_EQ(testBatchBase::alive, alive + 100);
+        for (std::size_t i = 1; i < batch.size(); i++){
+            ASSERT_EQ(reinterpret_cast<char*>(batch[i]) - reinterpret_cast<char*>(batch[i - 1]), static_cast<std::ptrdiff_t>(sizeof(testBatchDerivA)));
+        }
+        for (auto object : batch){
+            object->incA();
+            ASSERT_EQ(object->a, 2);
+        }
+    }
+    ASSERT_EQ(testBatchBase::alive, alive);
+}
+
+TEST_F(batchCreationTests, alignedBatch){
+    auto batch = testBatchFactory::createBatch(testBatchDerivB::getFactoryID(), 10);
+    ASSERT_EQ(batch.size(), 10u);
+    for (auto object : batch){
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(object) % alignof(testBatchDerivB), 0u);
+    }
+}
+
+TEST_F(batchCreationTests, unknownSizeBatch){
+    auto batch = testBatchFactory::createBatch(10, 5);
+    ASSERT_EQ(batch.size(), 5u);
+    ASSERT_FALSE(batch.contiguous());
+    for (auto object : batch){
+        ASSERT_NE(object, nullptr);
+        object->incA();
+        ASSERT_EQ(object->a, 2);
+    }
+}
+
+TEST_F(batchCreationTests, missingID){
+    auto batch = testBatchFactory::createBatch(42, 5);
+    ASSERT_TRUE(batch.empty());
+    batch = testBatchFactory::createBatch(testBatchDerivA::getFactoryID(), 0);
+    ASSERT_TRUE(batch.empty());
+}
+
+TEST_F(batchCreationTests, throwingConstructor){
+    int alive = testBatchBase::alive;
+    testBatchThrowing::constructed = 0;
+    ASSERT_THROW(testBatchFactory::createBatch(testBatchThrowing::getFactoryID(), 5), std::runtime_error);
+    ASSERT_EQ(testBatchBase::alive, alive);
+}
+
+TEST_F(batchCreationTests, mixedIDs){
+    int alive = testBatchBase::alive;
+    {
+        std::vector<int> ids = {2, 1, 42, 1, 10, 2, 0, 1};
+        auto batch = testBatchFactory::createBatch(ids);
+        ASSERT_EQ(batch.size(), ids.size());
+        ASSERT_FALSE(batch.contiguous());
+        ASSERT_EQ(testBatchBase::alive, alive + 7);
+
+        const int expected[] = {3, 2, -1, 2, 2, 3, 1, 2};
+        for (std::size_t i = 0; i < ids.size(); i++){
+            if (expected[i] < 0){
+                ASSERT_EQ(batch[i], nullptr);
+                continue;
+            }
+            ASSERT_NE(batch[i], nullptr);
+            batch[i]->incA();
+            ASSERT_EQ(batch[i]->a, expected[i]);
+        }
+        // objects of the same id share one block
+        ASSERT_EQ(batch[3] - batch[1], 1);
+    }
+    ASSERT_EQ(testBatchBase::alive, alive);
+}
+
+TEST_F(batchCreationTests, singleArgumentBatch){
+    std::vector<int> args = {1, 2, 3, 4};
+    auto batch = testBatchSingleArgFactory::createBatch(testBatchDerivB::getFactoryID(), args);
+    ASSERT_EQ(batch.size(), args.size());
+    ASSERT_TRUE(batch.contiguous());
+    for (std::size_t i = 0; i < args.size(); i++){
+        batch[i]->incA();
+        ASSERT_EQ(batch[i]->a, args[i] + 3);
+    }
+
+    auto fallback = testBatchSingleArgFactory::createBatch(10, args);
+    ASSERT_EQ(fallback.size(), args.size());
+    ASSERT_FALSE(fallback.contiguous());
+    ASSERT_EQ(fallback[3]->a, 4);
+
+    ASSERT_TRUE(testBatchSingleArgFactory::createBatch(42, args).empty());
+}
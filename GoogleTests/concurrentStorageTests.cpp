@@ -0,0 +1,139 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct testConcurrentBase{
+    typedef int __factoryIdentifierType__;
+    testConcurrentBase() = default;
+    explicit testConcurrentBase(int a) : a(a) {}
+    virtual ~testConcurrentBase() = default;
+    virtual void incA(){a++;}
+    static int getFactoryID(){return 0;}
+    int a = 0;
+};
+
+struct testConcurrentDerivA: public testConcurrentBase{
+    testConcurrentDerivA() = default;
+    explicit testConcurrentDerivA(int a) : testConcurrentBase(a) {}
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+};
+
+struct testConcurrentDerivB: public testConcurrentBase{
+    testConcurrentDerivB() = default;
+    explicit testConcurrentDerivB(int a) : testConcurrentBase(a) {}
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+typedef libFactory::ConcurrentBasicFactory<testConcurrentBase> testConcurrentFactory;
+typedef libFactory::ConcurrentSingleArgumentFactory<testConcurrentBase, int> testConcurrentSingleArgFactory;
+
+class concurrentStorageTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testConcurrentFactory::registerObject<testConcurrentBase>());
+        ASSERT_TRUE(testConcurrentFactory::registerObject<testConcurrentDerivA>());
+        ASSERT_TRUE(testConcurrentFactory::registerObject<testConcurrentDerivB>());
+        ASSERT_TRUE(testConcurrentSingleArgFactory::registerObjectConstructor<testConcurrentDerivA>());
+    }
+
+    void TearDown() override {
+        testConcurrentFactory::clearRegistry();
+        testConcurrentSingleArgFactory::clearRegistry();
+    }
+};
+
+TEST_F(concurrentStorageTests, createObjects){
+    auto ret1 = testConcurrentFactory::create(testConcurrentDerivA::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 2);
+
+    auto ret2 = testConcurrentSingleArgFactory::create(testConcurrentDerivA::getFactoryID(), 2);
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 4);
+
+    ASSERT_EQ(testConcurrentSingleArgFactory::create(testConcurrentDerivB::getFactoryID(), 2), nullptr);
+}
+
+TEST_F(concurrentStorageTests, removeRegistrations){
+    ASSERT_FALSE(testConcurrentFactory::registerObject<testConcurrentDerivA>());
+    ASSERT_TRUE(testConcurrentFactory::removeCreatorFunc(testConcurrentDerivA::getFactoryID()));
+    ASSERT_FALSE(testConcurrentFactory::removeCreatorFunc(testConcurrentDerivA::getFactoryID()));
+    ASSERT_EQ(testConcurrentFactory::create(testConcurrentDerivA::getFactoryID()), nullptr);
+    ASSERT_NE(testConcurrentFactory::create(testConcurrentDerivB::getFactoryID()), nullptr);
+
+    testConcurrentFactory::clearRegistry();
+    ASSERT_EQ(testConcurrentFactory::create(testConcurrentDerivB::getFactoryID()), nullptr);
+}
+
+TEST_F(concurrentStorageTests, createWhileRegistering){
+    constexpr int creatorThreads = 8;
+    constexpr int transientIDs = 64;
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+    std::atomic<long> created{0};
+
+    std::vector<std::thread> creators;
+    for (int t = 0; t < creatorThreads; t++){
+        creators.emplace_back([&, t](){
+            int i = t;
+            while (!stop.load(std::memory_order_relaxed)){
+                // the ids from SetUp are never removed and have to be found every time
+                auto stable = testConcurrentFactory::create(testConcurrentDerivB::getFactoryID());
+                if (!stable){
+                    failures++;
+                }else{
+                    stable->incA();
+                    if (stable->a != 3){
+                        failures++;
+                    }
+                }
+                // the transient ids come and go, if they are found the object has to be valid
+                if (auto transient = testConcurrentFactory::create(100 + i % transientIDs)){
+                    transient->incA();
+                    if (transient->a != 2){
+                        failures++;
+                    }
+                }
+                i++;
+                created++;
+            }
+        });
+    }
+
+    std::thread registrant([&](){
+        for (int round = 0; round < 200; round++){
+            for (int id = 100; id < 100 + transientIDs; id++){
+                testConcurrentFactory::registerObject<testConcurrentDerivA>(id);
+            }
+            for (int id = 100; id < 100 + transientIDs; id += 2){
+                testConcurrentFactory::removeCreatorFunc(id);
+            }
+            std::this_thread::yield();
+            for (int id = 101; id < 100 + transientIDs; id += 2){
+                testConcurrentFactory::removeCreatorFunc(id);
+            }
+        }
+        stop = true;
+    });
+
+    registrant.join();
+    for (auto& creator : creators){
+        creator.join();
+    }
+    ASSERT_EQ(failures, 0);
+    ASSERT_GT(created, 0);
+    ASSERT_NE(testConcurrentFactory::create(testConcurrentDerivB::getFactoryID()), nullptr);
+    ASSERT_EQ(testConcurrentFactory::create(100), nullptr);
+}
@@ -0,0 +1,138 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct testPlacedBase{
+    typedef int __factoryIdentifierType__;
+    static inline int alive = 0;
+    testPlacedBase() { alive++; }
+    explicit testPlacedBase(int a) : a(a) { alive++; }
+    virtual ~testPlacedBase() { alive--; }
+    int a = 0;
+};
+
+struct testPlacedSmall: public testPlacedBase{
+    testPlacedSmall() : testPlacedBase(1) {}
+    explicit testPlacedSmall(int a) : testPlacedBase(a) {}
+};
+
+struct alignas(64) testPlacedAligned: public testPlacedBase{
+    testPlacedAligned() : testPlacedBase(2) {}
+    explicit testPlacedAligned(int a) : testPlacedBase(a) {}
+    std::byte payload[100]{};
+};
+
+struct testPlacedString: public testPlacedBase{
+    explicit testPlacedString(std::string name) : testPlacedBase(static_cast<int>(name.size())), name(std::move(name)) {}
+    std::string name;
+};
+
+typedef libFactory::BasicFactory<testPlacedBase> testPlacedFactory;
+typedef libFactory::SingleArgumentFactory<testPlacedBase, int> testPlacedSingleArgFactory;
+typedef libFactory::ArgumentFactory<testPlacedBase, std::unique_ptr<testPlacedBase>(std::string)> testPlacedArgumentFactory;
+
+struct testPlacedAuto: public testPlacedBase, libFactory::autoRegister<testPlacedFactory, testPlacedAuto>{
+    testPlacedAuto() : testPlacedBase(3) { static_cast<void>(libFactory_bRegistered); }
+    static int getFactoryID(){ return 100; }
+    static std::unique_ptr<testPlacedBase> create(){ return std::make_unique<testPlacedAuto>(); }
+};
+
+class createIntoTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        testPlacedFactory::registerObject<testPlacedSmall>(1);
+        testPlacedFactory::registerObject<testPlacedAligned>(2);
+        testPlacedFactory::registerCreatorFunc(3, [](){ return std::unique_ptr<testPlacedBase>(new testPlacedSmall()); });
+    }
+
+    void TearDown() override {
+        testPlacedFactory::removeCreatorFunc(1);
+        testPlacedFactory::removeCreatorFunc(2);
+        testPlacedFactory::removeCreatorFunc(3);
+        testPlacedSingleArgFactory::clearRegistry();
+        testPlacedArgumentFactory::clearRegistry();
+        ASSERT_EQ(testPlacedBase::alive, 0);
+    }
+};
+
+TEST_F(createIntoTests, constructAndDestroy){
+    alignas(testPlacedSmall) std::byte buffer[sizeof(testPlacedSmall)];
+    auto placed = testPlacedFactory::createInto(1, buffer, sizeof(buffer));
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(static_cast<void*>(placed.object), static_cast<void*>(buffer));
+    ASSERT_EQ(placed.object->a, 1);
+    ASSERT_NE(dynamic_cast<testPlacedSmall*>(placed.object), nullptr);
+    ASSERT_EQ(testPlacedBase::alive, 1);
+    placed.destroy(placed.object);
+    ASSERT_EQ(testPlacedBase::alive, 0);
+}
+
+TEST_F(createIntoTests, alignment){
+    // a misaligned buffer with enough slack gets the object at the next aligned address
+    alignas(64) std::byte buffer[sizeof(testPlacedAligned) + 128];
+    auto placed = testPlacedFactory::createInto(2, buffer + 1, sizeof(buffer) - 1);
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(placed.object) % alignof(testPlacedAligned), 0);
+    ASSERT_EQ(static_cast<void*>(placed.object), static_cast<void*>(buffer + 64));
+    placed.destroy(placed.object);
+
+    // without the slack it does not fit
+    ASSERT_FALSE(testPlacedFactory::createInto(2, buffer + 1, sizeof(testPlacedAligned)));
+    ASSERT_EQ(testPlacedBase::alive, 0);
+}
+
+TEST_F(createIntoTests, undersizedBuffer){
+    alignas(testPlacedSmall) std::byte buffer[sizeof(testPlacedSmall)];
+    auto placed = testPlacedFactory::createInto(1, buffer, sizeof(buffer) - 1);
+    ASSERT_FALSE(placed);
+    ASSERT_EQ(placed.object, nullptr);
+    ASSERT_EQ(testPlacedBase::alive, 0);
+    ASSERT_FALSE(testPlacedFactory::createInto(1, nullptr, 0));
+}
+
+TEST_F(createIntoTests, unknownTypes){
+    alignas(64) std::byte buffer[256];
+    ASSERT_FALSE(testPlacedFactory::createInto(4, buffer, sizeof(buffer)));
+    // creator functions registered without a registration helper have no size
+    ASSERT_FALSE(testPlacedFactory::createInto(3, buffer, sizeof(buffer)));
+    ASSERT_NE(testPlacedFactory::create(3), nullptr);
+}
+
+TEST_F(createIntoTests, maxObjectSize){
+    ASSERT_EQ(testPlacedFactory::maxObjectSize(), sizeof(testPlacedAligned));
+    ASSERT_EQ(testPlacedFactory::maxObjectAlignment(), alignof(testPlacedAligned));
+    testPlacedFactory::removeCreatorFunc(2);
+    ASSERT_EQ(testPlacedFactory::maxObjectSize(), std::max(sizeof(testPlacedSmall), sizeof(testPlacedAuto)));
+    ASSERT_EQ(testPlacedSingleArgFactory::maxObjectSize(), 0);
+}
+
+TEST_F(createIntoTests, autoRegister){
+    alignas(testPlacedAuto) std::byte buffer[sizeof(testPlacedAuto)];
+    auto placed = testPlacedFactory::createInto(100, buffer, sizeof(buffer));
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(placed.object->a, 3);
+    placed.destroy(placed.object);
+}
+
+TEST_F(createIntoTests, arguments){
+    ASSERT_TRUE(testPlacedSingleArgFactory::registerObjectConstructor<testPlacedSmall>(1));
+    alignas(std::max_align_t) std::byte buffer[256];
+    auto placed = testPlacedSingleArgFactory::createInto(1, buffer, sizeof(buffer), 7);
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(placed.object->a, 7);
+    placed.destroy(placed.object);
+
+    ASSERT_TRUE(testPlacedArgumentFactory::registerObjectConstructor<testPlacedString>(1));
+    placed = testPlacedArgumentFactory::createInto(1, buffer, sizeof(buffer), std::string("placed"));
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(static_cast<testPlacedString*>(placed.object)->name, "placed");
+    ASSERT_EQ(placed.object->a, 6);
+    placed.destroy(placed.object);
+}
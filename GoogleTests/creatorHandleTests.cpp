@@ -0,0 +1,114 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+struct testHandleBase{
+    typedef int __factoryIdentifierType__;
+    testHandleBase() = default;
+    explicit testHandleBase(int a) : a(a) {}
+    virtual ~testHandleBase() = default;
+    int a = 0;
+};
+
+struct testHandleObject: public testHandleBase{
+    testHandleObject() : testHandleBase(1) {}
+    explicit testHandleObject(int a) : testHandleBase(a) {}
+    explicit testHandleObject(std::unique_ptr<int> a) : testHandleBase(*a) {}
+};
+
+typedef libFactory::BasicFactory<testHandleBase> testHandleFactory;
+typedef libFactory::SingleArgumentFactory<testHandleBase, int> testHandleSingleArgFactory;
+typedef libFactory::ArgumentFactory<testHandleBase, std::unique_ptr<testHandleBase>(std::unique_ptr<int>)> testHandleArgumentFactory;
+
+class creatorHandleTests: public ::testing::Test {
+protected:
+    void TearDown() override {
+        testHandleFactory::clearRegistry();
+        testHandleSingleArgFactory::clearRegistry();
+        testHandleArgumentFactory::clearRegistry();
+    }
+};
+
+TEST_F(creatorHandleTests, resolveAndCall){
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(1));
+    auto handle = testHandleFactory::resolve(1);
+    ASSERT_TRUE(handle.valid());
+    auto copy = handle;
+    ASSERT_TRUE(copy);
+    for (int i = 0; i < 3; i++){
+        auto ret = copy();
+        ASSERT_NE(ret, nullptr);
+        ASSERT_EQ(ret->a, 1);
+    }
+}
+
+TEST_F(creatorHandleTests, unknownID){
+    auto handle = testHandleFactory::resolve(1);
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(handle(), nullptr);
+    ASSERT_FALSE(testHandleFactory::creatorHandleType());
+}
+
+TEST_F(creatorHandleTests, invalidatedByRemove){
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(1));
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(2));
+    auto handle = testHandleFactory::resolve(1);
+
+    // registering and failed removals keep the handle valid
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(3));
+    ASSERT_FALSE(testHandleFactory::removeCreatorFunc(4));
+    ASSERT_TRUE(handle);
+
+    // removing any id invalidates it
+    ASSERT_TRUE(testHandleFactory::removeCreatorFunc(2));
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(handle(), nullptr);
+
+    auto resolved = testHandleFactory::resolve(1);
+    ASSERT_TRUE(resolved);
+    ASSERT_NE(resolved(), nullptr);
+}
+
+TEST_F(creatorHandleTests, invalidatedByClear){
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(1));
+    auto handle = testHandleFactory::resolve(1);
+    testHandleFactory::clearRegistry();
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(handle(), nullptr);
+    ASSERT_FALSE(testHandleFactory::resolve(1));
+}
+
+TEST_F(creatorHandleTests, sealed){
+    ASSERT_TRUE(testHandleFactory::registerObject<testHandleObject>(1));
+    auto handle = testHandleFactory::resolve(1);
+    ASSERT_TRUE(testHandleFactory::seal());
+    ASSERT_TRUE(handle);
+    auto sealedHandle = testHandleFactory::resolve(1);
+    ASSERT_TRUE(sealedHandle);
+    ASSERT_EQ(sealedHandle()->a, 1);
+}
+
+TEST_F(creatorHandleTests, singleArgumentFactory){
+    ASSERT_TRUE(testHandleSingleArgFactory::registerObjectConstructor<testHandleObject>(1));
+    auto handle = testHandleSingleArgFactory::resolve(1);
+    ASSERT_TRUE(handle);
+    auto ret = handle(5);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 5);
+    ASSERT_TRUE(testHandleSingleArgFactory::removeCreatorFunc(1));
+    ASSERT_EQ(handle(5), nullptr);
+}
+
+TEST_F(creatorHandleTests, argumentFactory){
+    ASSERT_TRUE(testHandleArgumentFactory::registerObjectConstructor<testHandleObject>(1));
+    auto handle = testHandleArgumentFactory::resolve(1);
+    ASSERT_TRUE(handle);
+    auto ret = handle(std::make_unique<int>(6));
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 6);
+}
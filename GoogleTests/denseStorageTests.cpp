@@ -0,0 +1,164 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+static_assert(std::is_same_v<libFactory::AutoStorage<int, int>, libFactory::DenseStorage<int, int>>);
+static_assert(std::is_same_v<libFactory::AutoStorage<std::string, int>, libFactory::MapStorage<std::string, int>>);
+
+TEST(denseStorageTests, negativeIds){
+    libFactory::DenseStorage<int, int> storage;
+    for (int i = -10; i <= 10; i++){
+        ASSERT_TRUE(storage.insert(i, i * 10));
+    }
+    ASSERT_FALSE(storage.insert(-10, 0));
+    ASSERT_EQ(storage.size(), 21);
+    for (int i = -10; i <= 10; i++){
+        ASSERT_EQ(*storage.find(i), i * 10);
+    }
+    ASSERT_FALSE(storage.find(-11));
+    ASSERT_FALSE(storage.find(11));
+}
+
+TEST(denseStorageTests, extremeIds){
+    libFactory::DenseStorage<long long, int> storage;
+    ASSERT_TRUE(storage.insert(std::numeric_limits<long long>::min(), 1));
+    ASSERT_TRUE(storage.insert(std::numeric_limits<long long>::max(), 2));
+    ASSERT_TRUE(storage.insert(0, 3));
+    ASSERT_EQ(*storage.find(std::numeric_limits<long long>::min()), 1);
+    ASSERT_EQ(*storage.find(std::numeric_limits<long long>::max()), 2);
+    ASSERT_EQ(*storage.find(0), 3);
+    ASSERT_FALSE(storage.find(1));
+
+    libFactory::DenseStorage<unsigned, int> unsignedStorage;
+    ASSERT_TRUE(unsignedStorage.insert(0u, 1));
+    ASSERT_TRUE(unsignedStorage.insert(std::numeric_limits<unsigned>::max(), 2));
+    ASSERT_EQ(*unsignedStorage.find(0u), 1);
+    ASSERT_EQ(*unsignedStorage.find(std::numeric_limits<unsigned>::max()), 2);
+    ASSERT_FALSE(unsignedStorage.find(1u));
+}
+
+TEST(denseStorageTests, sparseOutliers){
+    libFactory::DenseStorage<int, int> storage;
+    for (int i = 0; i < 50; i++){
+        ASSERT_TRUE(storage.insert(i, i));
+    }
+    // far away ids go to the fallback and do not blow up the table
+    ASSERT_TRUE(storage.insert(1000000, 1));
+    ASSERT_TRUE(storage.insert(-1000000, 2));
+    ASSERT_FALSE(storage.insert(1000000, 3));
+    ASSERT_EQ(storage.size(), 52);
+    ASSERT_EQ(*storage.find(1000000), 1);
+    ASSERT_EQ(*storage.find(-1000000), 2);
+    ASSERT_FALSE(storage.find(999999));
+
+    ASSERT_TRUE(storage.erase(1000000));
+    ASSERT_FALSE(storage.erase(1000000));
+    ASSERT_FALSE(storage.find(1000000));
+    ASSERT_EQ(storage.size(), 51);
+}
+
+TEST(denseStorageTests, adoptOutliers){
+    libFactory::DenseStorage<int, int> storage;
+    ASSERT_TRUE(storage.insert(0, 0));
+    ASSERT_TRUE(storage.insert(200, 200));
+
+    // once enough ids fill the gap the table grows over the outlier and takes it in
+    for (int i = 1; i < 200; i++){
+        ASSERT_TRUE(storage.insert(i, i));
+    }
+    ASSERT_EQ(storage.size(), 201);
+    for (int i = 0; i <= 200; i++){
+        ASSERT_EQ(*storage.find(i), i);
+    }
+    ASSERT_FALSE(storage.insert(200, 0));
+    ASSERT_TRUE(storage.erase(200));
+    ASSERT_FALSE(storage.find(200));
+}
+
+TEST(denseStorageTests, eraseAndClear){
+    libFactory::DenseStorage<int, int> storage;
+    ASSERT_FALSE(storage.erase(0));
+    ASSERT_TRUE(storage.insert(5, 5));
+    ASSERT_TRUE(storage.erase(5));
+    ASSERT_EQ(storage.size(), 0);
+
+    // the empty table starts over at the next id
+    ASSERT_TRUE(storage.insert(100000, 1));
+    ASSERT_TRUE(storage.insert(100001, 2));
+    ASSERT_EQ(*storage.find(100001), 2);
+
+    storage.clear();
+    ASSERT_EQ(storage.size(), 0);
+    ASSERT_FALSE(storage.find(100000));
+    ASSERT_TRUE(storage.insert(100000, 3));
+    ASSERT_EQ(*storage.find(100000), 3);
+}
+
+TEST(denseStorageTests, forEach){
+    libFactory::DenseStorage<int, int> storage;
+    std::vector<int> inserted = {3, -2, 7, 0, 1000000};
+    for (int id : inserted){
+        ASSERT_TRUE(storage.insert(id, id * 2));
+    }
+    std::vector<int> visited;
+    storage.forEach([&visited](int id, int value){
+        ASSERT_EQ(value, id * 2);
+        visited.push_back(id);
+    });
+    ASSERT_EQ(visited, std::vector<int>({-2, 0, 3, 7, 1000000}));
+}
+
+TEST(denseStorageTests, insertBulk){
+    libFactory::DenseStorage<int, int> storage;
+    std::vector<std::pair<int, int>> values;
+    for (int i = 999; i >= 0; i--){
+        values.emplace_back(i, i);
+    }
+    values.emplace_back(5000000, 1);
+    ASSERT_EQ(storage.insertBulk(values), 1001);
+    for (int i = 0; i < 1000; i++){
+        ASSERT_EQ(*storage.find(i), i);
+    }
+    ASSERT_EQ(*storage.find(5000000), 1);
+}
+
+enum class testDenseID: unsigned char{
+    first, second, third
+};
+
+struct testDenseBase{
+    typedef testDenseID __factoryIdentifierType__;
+    virtual ~testDenseBase() = default;
+    virtual testDenseID id() const = 0;
+};
+
+template<testDenseID objectID>
+struct testDenseObject: public testDenseBase{
+    static testDenseID getFactoryID(){ return objectID; }
+    testDenseID id() const override{ return objectID; }
+};
+
+// the default storage of a factory with enum ids is the dense table
+typedef libFactory::BasicFactory<testDenseBase> testDenseFactory;
+
+TEST(denseStorageTests, enumFactory){
+    ASSERT_TRUE(testDenseFactory::registerObject<testDenseObject<testDenseID::first>>());
+    ASSERT_TRUE(testDenseFactory::registerObject<testDenseObject<testDenseID::third>>());
+    ASSERT_FALSE(testDenseFactory::registerObject<testDenseObject<testDenseID::third>>());
+
+    ASSERT_EQ(testDenseFactory::create(testDenseID::first)->id(), testDenseID::first);
+    ASSERT_EQ(testDenseFactory::create(testDenseID::third)->id(), testDenseID::third);
+    ASSERT_EQ(testDenseFactory::create(testDenseID::second), nullptr);
+
+    ASSERT_TRUE(testDenseFactory::removeCreatorFunc(testDenseID::first));
+    ASSERT_EQ(testDenseFactory::create(testDenseID::first), nullptr);
+    testDenseFactory::clearRegistry();
+    ASSERT_EQ(testDenseFactory::create(testDenseID::third), nullptr);
+}
@@ -0,0 +1,120 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+// two names with the same 64 bit FNV-1a hash
+constexpr const char* testIdCollisionA = "wIuo5RrErjh";
+constexpr const char* testIdCollisionB = "xIf4tsHJdYc";
+
+static_assert(libFactory::FactoryId().getValue() == 0xcbf29ce484222325ull);
+static_assert(libFactory::FactoryId("a").getValue() == 0xaf63dc4c8601ec8cull);
+static_assert(libFactory::FactoryId("tcp_handler").getName() == "tcp_handler");
+static_assert(libFactory::FactoryId(testIdCollisionA) == libFactory::FactoryId(testIdCollisionB));
+static_assert(libFactory::FactoryId("tcp_handler") != libFactory::FactoryId("udp_handler"));
+
+struct testIdBase{
+    typedef libFactory::FactoryId __factoryIdentifierType__;
+    virtual ~testIdBase() = default;
+    virtual int value() const = 0;
+};
+
+struct testIdTcp: public testIdBase{
+    static constexpr libFactory::FactoryId getFactoryID(){ return "tcp_handler"; }
+    int value() const override { return 1; }
+};
+
+struct testIdUdp: public testIdBase{
+    static constexpr libFactory::FactoryId getFactoryID(){ return "udp_handler"; }
+    int value() const override { return 2; }
+};
+
+struct testIdCollidingA: public testIdBase{
+    static constexpr libFactory::FactoryId getFactoryID(){ return testIdCollisionA; }
+    int value() const override { return 3; }
+};
+
+struct testIdCollidingB: public testIdBase{
+    static constexpr libFactory::FactoryId getFactoryID(){ return testIdCollisionB; }
+    int value() const override { return 4; }
+};
+
+template<template<class, class> class registryStorage>
+struct factoryIdStoragePolicy{
+    typedef libFactory::BasicFactory<testIdBase, libFactory::FactoryId, std::unique_ptr<testIdBase>, registryStorage> factory;
+};
+
+template<class policy>
+class factoryIdTests: public ::testing::Test {
+protected:
+    typedef typename policy::factory factory;
+
+    void SetUp() override {
+        ASSERT_TRUE(factory::template registerObject<testIdTcp>());
+        ASSERT_TRUE(factory::template registerObject<testIdUdp>());
+    }
+
+    void TearDown() override {
+        factory::clearRegistry();
+    }
+};
+
+typedef ::testing::Types<factoryIdStoragePolicy<libFactory::MapStorage>, factoryIdStoragePolicy<libFactory::FlatStorage>, factoryIdStoragePolicy<libFactory::HashStorage>, factoryIdStoragePolicy<libFactory::ConcurrentStorage>> factoryIdStoragePolicyTypes;
+TYPED_TEST_SUITE(factoryIdTests, factoryIdStoragePolicyTypes);
+
+TYPED_TEST(factoryIdTests, createFromName){
+    auto ret1 = TestFixture::factory::create("tcp_handler");
+    ASSERT_NE(ret1, nullptr);
+    ASSERT_EQ(ret1->value(), 1);
+
+    constexpr libFactory::FactoryId udp("udp_handler");
+    auto ret2 = TestFixture::factory::create(udp);
+    ASSERT_NE(ret2, nullptr);
+    ASSERT_EQ(ret2->value(), 2);
+
+    std::string runtimeName = "tcp_handler";
+    ASSERT_NE(TestFixture::factory::create(libFactory::FactoryId(std::string_view(runtimeName))), nullptr);
+    // ids that were stored as their hash are found without their name
+    ASSERT_NE(TestFixture::factory::create(libFactory::FactoryId::fromValue(udp.getValue())), nullptr);
+    ASSERT_EQ(TestFixture::factory::create("sctp_handler"), nullptr);
+
+    ASSERT_TRUE(TestFixture::factory::seal());
+    ASSERT_EQ(TestFixture::factory::create("tcp_handler")->value(), 1);
+    ASSERT_EQ(TestFixture::factory::create("sctp_handler"), nullptr);
+}
+
+TYPED_TEST(factoryIdTests, collisionRejected){
+    ASSERT_TRUE(TestFixture::factory::template registerObject<testIdCollidingA>());
+    ASSERT_FALSE(TestFixture::factory::template registerObject<testIdCollidingB>());
+    ASSERT_EQ(TestFixture::factory::create(testIdCollisionB)->value(), 3);
+
+    auto collisions = TestFixture::factory::getCollisions();
+    ASSERT_EQ(collisions.size(), 1);
+    ASSERT_EQ(collisions[0].registered.getName(), testIdCollisionA);
+    ASSERT_EQ(collisions[0].rejected.getName(), testIdCollisionB);
+
+    // registering the same name twice is not a collision
+    ASSERT_FALSE(TestFixture::factory::template registerObject<testIdTcp>());
+    ASSERT_FALSE(TestFixture::factory::template registerObject<testIdCollidingA>());
+    ASSERT_FALSE(TestFixture::factory::template registerObject<testIdCollidingA>(libFactory::FactoryId::fromValue(libFactory::FactoryId(testIdCollisionA).getValue())));
+    ASSERT_EQ(TestFixture::factory::getCollisions().size(), 1);
+
+    TestFixture::factory::clearRegistry();
+    ASSERT_TRUE(TestFixture::factory::getCollisions().empty());
+    ASSERT_TRUE(TestFixture::factory::template registerObject<testIdCollidingB>());
+}
+
+TEST(factoryIdInstanceTests, collisionPerInstance){
+    typedef libFactory::BasicFactory<testIdBase> factory;
+    factory::factoryInstance instance(factory::replicationMode::none);
+    ASSERT_TRUE(instance.registerCreatorFunc(testIdCollisionA, [](){ return std::unique_ptr<testIdBase>(new testIdCollidingA); }));
+    ASSERT_FALSE(instance.registerCreatorFunc(testIdCollisionB, [](){ return std::unique_ptr<testIdBase>(new testIdCollidingB); }));
+    ASSERT_EQ(instance.getCollisions().size(), 1);
+    ASSERT_TRUE(factory::getCollisions().empty());
+}
@@ -0,0 +1,191 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct testInstanceBase{
+    typedef int __factoryIdentifierType__;
+    testInstanceBase() = default;
+    explicit testInstanceBase(int a) : a(a) {}
+    virtual ~testInstanceBase() = default;
+    int a = 0;
+};
+
+struct testInstanceObject: public testInstanceBase{
+    explicit testInstanceObject(int a) : testInstanceBase(a) {}
+};
+
+typedef libFactory::SingleArgumentFactory<testInstanceBase, int> testInstanceFactory;
+typedef libFactory::SingleArgumentFactory<testInstanceBase, int, int, std::unique_ptr<testInstanceBase>, libFactory::ConcurrentStorage> testInstanceConcurrentFactory;
+typedef testInstanceFactory::factoryInstance testInstance;
+typedef testInstanceConcurrentFactory::factoryInstance testInstanceConcurrent;
+
+static std::unique_ptr<testInstanceBase> testInstanceCreate(int a){
+    return std::make_unique<testInstanceBase>(a);
+}
+
+static std::unique_ptr<testInstanceBase> testInstanceCreateDouble(int a){
+    return std::make_unique<testInstanceBase>(a * 2);
+}
+
+class factoryInstanceTests: public ::testing::Test {
+protected:
+    void TearDown() override {
+        testInstanceFactory::setReplication(testInstanceFactory::replicationMode::none);
+        testInstanceFactory::clearRegistry();
+    }
+};
+
+TEST_F(factoryInstanceTests, isolation){
+    testInstance first;
+    testInstance second;
+    ASSERT_TRUE(first.registerCreatorFunc(1, &testInstanceCreate));
+    ASSERT_TRUE(second.registerCreatorFunc(1, &testInstanceCreateDouble));
+    ASSERT_FALSE(first.registerCreatorFunc(1, &testInstanceCreateDouble));
+
+    ASSERT_EQ(first.create(1, 3)->a, 3);
+    ASSERT_EQ(second.create(1, 3)->a, 6);
+    ASSERT_EQ(first.create(2, 3), nullptr);
+
+    // neither instance is visible through the static functions
+    ASSERT_EQ(testInstanceFactory::create(1, 3), nullptr);
+    ASSERT_TRUE(testInstanceFactory::registerCreatorFunc(2, &testInstanceCreate));
+    ASSERT_EQ(first.create(2, 3), nullptr);
+
+    ASSERT_TRUE(first.removeCreatorFunc(1));
+    ASSERT_FALSE(first.removeCreatorFunc(1));
+    ASSERT_EQ(first.create(1, 3), nullptr);
+    ASSERT_EQ(second.create(1, 3)->a, 6);
+
+    second.clearRegistry();
+    ASSERT_EQ(second.create(1, 3), nullptr);
+    ASSERT_NE(testInstanceFactory::create(2, 3), nullptr);
+}
+
+TEST_F(factoryInstanceTests, sealAndResolve){
+    testInstance first;
+    testInstance second;
+    ASSERT_TRUE(first.registerCreatorFunc(1, &testInstanceCreate));
+    ASSERT_TRUE(second.registerCreatorFunc(1, &testInstanceCreate));
+
+    ASSERT_TRUE(first.seal());
+    ASSERT_TRUE(first.isSealed());
+    ASSERT_FALSE(second.isSealed());
+    ASSERT_FALSE(testInstanceFactory::isSealed());
+    ASSERT_FALSE(first.registerCreatorFunc(2, &testInstanceCreate));
+    ASSERT_TRUE(second.registerCreatorFunc(2, &testInstanceCreate));
+    ASSERT_EQ(first.create(1, 4)->a, 4);
+
+    // removals only invalidate the handles of their own instance
+    auto firstHandle = first.resolve(1);
+    auto secondHandle = second.resolve(1);
+    ASSERT_TRUE(second.removeCreatorFunc(2));
+    ASSERT_TRUE(firstHandle);
+    ASSERT_FALSE(secondHandle);
+    ASSERT_EQ(firstHandle(5)->a, 5);
+
+    first.clearRegistry();
+    ASSERT_FALSE(first.isSealed());
+    ASSERT_FALSE(firstHandle);
+}
+
+TEST_F(factoryInstanceTests, defaultInstance){
+    ASSERT_TRUE(testInstanceFactory::registerObjectConstructor<testInstanceObject>(1));
+    auto& defaultInstance = testInstanceFactory::getDefaultInstance();
+    ASSERT_EQ(&defaultInstance, &testInstanceFactory::getDefaultInstance());
+    ASSERT_EQ(defaultInstance.create(1, 7)->a, 7);
+    ASSERT_EQ(defaultInstance.maxObjectSize(), sizeof(testInstanceObject));
+    ASSERT_EQ(&defaultInstance.getInstrumentation(), &testInstanceFactory::getInstrumentation());
+
+    alignas(testInstanceObject) std::byte buffer[sizeof(testInstanceObject)];
+    auto placed = defaultInstance.createInto(1, buffer, sizeof(buffer), 8);
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(placed.object->a, 8);
+    placed.destroy(placed.object);
+
+    ASSERT_TRUE(defaultInstance.registerCreatorFunc(2, &testInstanceCreate));
+    ASSERT_EQ(testInstanceFactory::create(2, 9)->a, 9);
+    ASSERT_TRUE(defaultInstance.seal());
+    ASSERT_TRUE(testInstanceFactory::isSealed());
+}
+
+TEST_F(factoryInstanceTests, perThreadReplication){
+    testInstance instance(testInstanceFactory::replicationMode::perThread);
+    ASSERT_TRUE(instance.registerCreatorFunc(1, &testInstanceCreate));
+    auto handle = instance.resolve(1);
+    ASSERT_EQ(instance.create(1, 1)->a, 1);
+
+    // registrations of other threads show up in the replica of this thread
+    std::thread([&instance](){
+        ASSERT_EQ(instance.create(1, 2)->a, 2);
+        ASSERT_TRUE(instance.registerCreatorFunc(2, &testInstanceCreateDouble));
+        ASSERT_TRUE(instance.removeCreatorFunc(1));
+    }).join();
+    ASSERT_EQ(instance.create(2, 2)->a, 4);
+    ASSERT_EQ(instance.create(1, 2), nullptr);
+    ASSERT_FALSE(handle);
+
+    // lookups and modifications from several threads at once
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++){
+        threads.emplace_back([&instance, &failed, i](){
+            for (int j = 0; j < 200; j++){
+                auto object = instance.create(2, j);
+                if (!object || object->a != j * 2){
+                    failed = true;
+                }
+                if (i == 0){
+                    instance.registerCreatorFunc(10 + j, &testInstanceCreate);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads){
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+    ASSERT_EQ(instance.create(209, 5)->a, 5);
+}
+
+TEST_F(factoryInstanceTests, reusedReplicaSlot){
+    // a new instance that takes over the slot of a destroyed one must not see its replicas
+    {
+        testInstance instance(testInstanceFactory::replicationMode::perThread);
+        ASSERT_TRUE(instance.registerCreatorFunc(1, &testInstanceCreate));
+        ASSERT_NE(instance.create(1, 1), nullptr);
+    }
+    testInstance instance(testInstanceFactory::replicationMode::perThread);
+    ASSERT_EQ(instance.create(1, 1), nullptr);
+}
+
+TEST_F(factoryInstanceTests, staticReplication){
+    testInstanceFactory::setReplication(testInstanceFactory::replicationMode::perThread);
+    ASSERT_TRUE(testInstanceFactory::registerCreatorFunc(1, &testInstanceCreate));
+    ASSERT_EQ(testInstanceFactory::create(1, 1)->a, 1);
+    std::thread([](){
+        ASSERT_EQ(testInstanceFactory::create(1, 2)->a, 2);
+    }).join();
+    ASSERT_TRUE(testInstanceFactory::removeCreatorFunc(1));
+    ASSERT_EQ(testInstanceFactory::create(1, 1), nullptr);
+
+}
+
+TEST_F(factoryInstanceTests, concurrentStorageReplication){
+    // the replicas of a concurrent storage are looked up without taking its lock
+    testInstanceConcurrent instance(testInstanceConcurrentFactory::replicationMode::perThread);
+    ASSERT_TRUE(instance.registerCreatorFunc(1, &testInstanceCreate));
+    std::thread([&instance](){
+        ASSERT_EQ(instance.create(1, 2)->a, 2);
+        ASSERT_TRUE(instance.removeCreatorFunc(1));
+        ASSERT_EQ(instance.create(1, 2), nullptr);
+    }).join();
+    ASSERT_EQ(instance.create(1, 2), nullptr);
+}
@@ -0,0 +1,126 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct testInstrumentedBase{
+    typedef std::string __factoryIdentifierType__;
+    testInstrumentedBase() = default;
+    explicit testInstrumentedBase(int a) : a(a) {}
+    virtual ~testInstrumentedBase() = default;
+    int a = 0;
+};
+
+struct testInstrumentedObject: public testInstrumentedBase{
+    testInstrumentedObject() = default;
+    explicit testInstrumentedObject(int a) : testInstrumentedBase(a) {}
+};
+
+typedef libFactory::BasicFactory<testInstrumentedBase, std::string, std::unique_ptr<testInstrumentedBase>, libFactory::MapStorage, libFactory::CreationMetrics> testInstrumentedFactory;
+typedef libFactory::SingleArgumentFactory<testInstrumentedBase, int, int, std::unique_ptr<testInstrumentedBase>, libFactory::HashStorage, libFactory::CreationMetrics> testInstrumentedSingleArgFactory;
+
+static_assert(std::is_empty_v<libFactory::NoInstrumentation<int>>);
+static_assert(std::is_empty_v<libFactory::NoInstrumentation<int>::hitScope>);
+
+typedef libFactory::CreationMetrics<std::string>::idMetrics testStringMetrics;
+
+static const testStringMetrics* findMetrics(const std::vector<testStringMetrics>& metrics, const std::string& id){
+    auto it = std::find_if(metrics.begin(), metrics.end(), [&id](const testStringMetrics& m){ return m.id == id; });
+    return it == metrics.end() ? nullptr : &*it;
+}
+
+static std::uint64_t histogramTotal(const testStringMetrics& metrics){
+    return std::accumulate(metrics.latency.begin(), metrics.latency.end(), std::uint64_t(0));
+}
+
+class instrumentationTests: public ::testing::Test {
+protected:
+    static void SetUpTestSuite(){
+        testInstrumentedFactory::registerObject<testInstrumentedObject>("object");
+        testInstrumentedFactory::registerObject<testInstrumentedObject>("threaded");
+        testInstrumentedSingleArgFactory::registerObjectConstructor<testInstrumentedObject>(1);
+    }
+};
+
+TEST_F(instrumentationTests, hitsAndMisses){
+    for (int i = 0; i < 5; i++){
+        ASSERT_NE(testInstrumentedFactory::create("object"), nullptr);
+    }
+    ASSERT_EQ(testInstrumentedFactory::create("missing"), nullptr);
+    ASSERT_EQ(testInstrumentedFactory::create(std::string_view("missing")), nullptr);
+
+    auto metrics = testInstrumentedFactory::getInstrumentation().snapshot();
+    auto object = findMetrics(metrics, "object");
+    ASSERT_NE(object, nullptr);
+    ASSERT_EQ(object->hits, 5);
+    ASSERT_EQ(object->misses, 0);
+    ASSERT_EQ(histogramTotal(*object), 5);
+
+    auto missing = findMetrics(metrics, "missing");
+    ASSERT_NE(missing, nullptr);
+    ASSERT_EQ(missing->hits, 0);
+    ASSERT_EQ(missing->misses, 2);
+    ASSERT_EQ(histogramTotal(*missing), 0);
+}
+
+TEST_F(instrumentationTests, threadsAreSummed){
+    constexpr int threadCount = 8;
+    constexpr int createsPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++){
+        threads.emplace_back([](){
+            for (int i = 0; i < createsPerThread; i++){
+                testInstrumentedFactory::create("threaded");
+            }
+        });
+    }
+    // snapshots while the threads are counting must not disturb them
+    for (int i = 0; i < 10; i++){
+        testInstrumentedFactory::getInstrumentation().snapshot();
+    }
+    for (auto& thread : threads){
+        thread.join();
+    }
+
+    // the counts of exited threads are kept
+    auto metrics = testInstrumentedFactory::getInstrumentation().snapshot();
+    auto threaded = findMetrics(metrics, "threaded");
+    ASSERT_NE(threaded, nullptr);
+    ASSERT_EQ(threaded->hits, threadCount * createsPerThread);
+    ASSERT_EQ(histogramTotal(*threaded), threadCount * createsPerThread);
+
+    // a new thread takes over the table of an exited one and keeps counting
+    std::thread([](){ testInstrumentedFactory::create("threaded"); }).join();
+    metrics = testInstrumentedFactory::getInstrumentation().snapshot();
+    ASSERT_EQ(findMetrics(metrics, "threaded")->hits, threadCount * createsPerThread + 1);
+}
+
+TEST_F(instrumentationTests, singleArgumentFactory){
+    auto ret = testInstrumentedSingleArgFactory::create(1, 4);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 4);
+    ASSERT_EQ(testInstrumentedSingleArgFactory::create(2, 4), nullptr);
+
+    auto metrics = testInstrumentedSingleArgFactory::getInstrumentation().snapshot();
+    ASSERT_EQ(metrics.size(), 2);
+    for (const auto& m : metrics){
+        ASSERT_EQ(m.hits, m.id == 1 ? 1 : 0);
+        ASSERT_EQ(m.misses, m.id == 2 ? 1 : 0);
+    }
+}
+
+TEST_F(instrumentationTests, dump){
+    testInstrumentedFactory::create("object");
+    std::ostringstream out;
+    testInstrumentedFactory::getInstrumentation().dump(out);
+    ASSERT_NE(out.str().find("object: hits="), std::string::npos);
+    ASSERT_NE(out.str().find("latency(ns)={<"), std::string::npos);
+}
@@ -0,0 +1,113 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct testPoolBase{
+    typedef int __factoryIdentifierType__;
+    testPoolBase() = default;
+    explicit testPoolBase(int a) : a(a) {}
+    virtual ~testPoolBase() = default;
+    virtual void incA(){a++;}
+    static int getFactoryID(){return 0;}
+    int a = 0;
+};
+
+struct testPoolDerivA: public testPoolBase{
+    testPoolDerivA() { alive++; }
+    explicit testPoolDerivA(int a) : testPoolBase(a) { alive++; }
+    ~testPoolDerivA() override { alive--; }
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+    static inline int alive = 0;
+};
+
+struct alignas(64) testPoolAligned: public testPoolBase{
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+typedef libFactory::BasicFactory<testPoolBase, int, libFactory::FactoryPtr<testPoolBase>> testPoolFactory;
+typedef libFactory::SingleArgumentFactory<testPoolBase, int, int, libFactory::FactoryPtr<testPoolBase>> testPoolSingleArgFactory;
+
+class objectPoolTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testPoolFactory::registerObject<testPoolBase>());
+        ASSERT_TRUE(testPoolFactory::registerPooledObject<testPoolDerivA>());
+        ASSERT_TRUE(testPoolFactory::registerPooledObject<testPoolAligned>());
+        ASSERT_TRUE(testPoolSingleArgFactory::registerPooledObjectConstructor<testPoolDerivA>());
+    }
+
+    void TearDown() override {
+        testPoolFactory::clearRegistry();
+        testPoolSingleArgFactory::clearRegistry();
+    }
+};
+
+TEST_F(objectPoolTests, createObjects){
+    auto ret1 = testPoolFactory::create(testPoolBase::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 1);
+
+    auto ret2 = testPoolFactory::create(testPoolDerivA::getFactoryID());
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 2);
+
+    auto ret3 = testPoolSingleArgFactory::create(testPoolDerivA::getFactoryID(), 2);
+    ASSERT_NE(ret3, nullptr);
+    ret3->incA();
+    ASSERT_EQ(ret3->a, 4);
+
+    ASSERT_EQ(testPoolFactory::create(3), nullptr);
+}
+
+TEST_F(objectPoolTests, destroyAndReuse){
+    int alive = testPoolDerivA::alive;
+    auto ret = testPoolFactory::create(testPoolDerivA::getFactoryID());
+    ASSERT_EQ(testPoolDerivA::alive, alive + 1);
+    testPoolBase* address = ret.get();
+    ret.reset();
+    ASSERT_EQ(testPoolDerivA::alive, alive);
+
+    // the block just freed is at the top of this thread's cache
+    ret = testPoolFactory::create(testPoolDerivA::getFactoryID());
+    ASSERT_EQ(ret.get(), address);
+}
+
+TEST_F(objectPoolTests, alignment){
+    std::vector<libFactory::FactoryPtr<testPoolBase>> objects;
+    for (int i = 0; i < 200; i++){
+        objects.push_back(testPoolFactory::create(testPoolAligned::getFactoryID()));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(objects.back().get()) % alignof(testPoolAligned), 0u);
+    }
+}
+
+TEST_F(objectPoolTests, crossThreadDestroy){
+    int alive = testPoolDerivA::alive;
+    std::vector<libFactory::FactoryPtr<testPoolBase>> objects;
+    std::thread creator([&objects](){
+        for (int i = 0; i < 1000; i++){
+            objects.push_back(testPoolFactory::create(testPoolDerivA::getFactoryID()));
+        }
+    });
+    creator.join();
+    ASSERT_EQ(testPoolDerivA::alive, alive + 1000);
+
+    std::thread destroyer([&objects](){
+        objects.clear();
+    });
+    destroyer.join();
+    ASSERT_EQ(testPoolDerivA::alive, alive);
+
+    auto ret = testPoolFactory::create(testPoolDerivA::getFactoryID());
+    ASSERT_NE(ret, nullptr);
+}
@@ -0,0 +1,191 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct testStreamObjBase{
+    typedef int __factoryIdentifierType__;
+    testStreamObjBase() { constructed++; alive++; }
+    explicit testStreamObjBase(int arg) : arg(arg) { constructed++; alive++; }
+    virtual ~testStreamObjBase() { alive--; }
+    virtual int value() const = 0;
+    int arg = 0;
+    static inline int constructed = 0;
+    static inline int alive = 0;
+};
+
+struct testStreamObjA: public testStreamObjBase{
+    using testStreamObjBase::testStreamObjBase;
+    int value() const override { return 1; }
+};
+
+struct testStreamObjB: public testStreamObjBase{
+    using testStreamObjBase::testStreamObjBase;
+    int value() const override { return 2; }
+};
+
+struct testStreamObjThrowing: public testStreamObjBase{
+    testStreamObjThrowing() { throw std::runtime_error("testStreamObjThrowing"); }
+    int value() const override { return 3; }
+};
+
+struct testStreamObjStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~testStreamObjStringBase() = default;
+};
+
+typedef libFactory::BasicFactory<testStreamObjBase> testStreamObjFactory;
+typedef libFactory::SingleArgumentFactory<testStreamObjBase, int> testStreamObjArgFactory;
+typedef libFactory::BasicFactory<testStreamObjStringBase> testStreamObjStringFactory;
+
+static_assert(std::ranges::input_range<libFactory::ObjectStream<std::unique_ptr<testStreamObjBase>>>);
+static_assert(std::ranges::view<libFactory::ObjectStream<std::unique_ptr<testStreamObjBase>>>);
+
+class objectStreamTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        testStreamObjBase::constructed = 0;
+        testStreamObjBase::alive = 0;
+        ASSERT_TRUE(testStreamObjFactory::registerObject<testStreamObjA>(1));
+        ASSERT_TRUE(testStreamObjFactory::registerObject<testStreamObjB>(2));
+        ASSERT_TRUE(testStreamObjFactory::registerObject<testStreamObjThrowing>(3));
+        ASSERT_TRUE(testStreamObjArgFactory::registerObjectConstructor<testStreamObjA>(1));
+        ASSERT_TRUE(testStreamObjArgFactory::registerObjectConstructor<testStreamObjB>(2));
+    }
+
+    void TearDown() override {
+        testStreamObjFactory::clearRegistry();
+        testStreamObjArgFactory::clearRegistry();
+        testStreamObjStringFactory::clearRegistry();
+    }
+};
+
+TEST_F(objectStreamTests, lazyCreation){
+    std::vector<int> ids = {1, 1, 2, 100, 2, 1};
+    auto stream = testStreamObjFactory::createStream(ids);
+    auto it = stream.begin();
+    ASSERT_EQ(testStreamObjBase::constructed, 0);
+    ASSERT_EQ((*it)->value(), 1);
+    ASSERT_EQ(testStreamObjBase::constructed, 1);
+    // skipping an object that was not looked at still creates it, so every id is created in order
+    ++it;
+    ++it;
+    ASSERT_EQ((*it)->value(), 2);
+    ASSERT_EQ(testStreamObjBase::constructed, 3);
+    // the current object stays in the stream until it is moved out or the stream goes on
+    ASSERT_EQ(testStreamObjBase::alive, 1);
+
+    testStreamObjBase::constructed = 0;
+    stream = testStreamObjFactory::createStream(ids);
+
+    std::vector<int> values;
+    for (auto it = stream.begin(); it != stream.end(); ++it){
+        auto object = *it;
+        if (object){
+            values.push_back(object->value());
+            // only the object that is being consumed is alive
+            ASSERT_EQ(testStreamObjBase::alive, 1);
+        }else{
+            values.push_back(0);
+        }
+    }
+    ASSERT_EQ(values, std::vector<int>({1, 1, 2, 0, 2, 1}));
+    ASSERT_EQ(testStreamObjBase::constructed, 5);
+    ASSERT_EQ(testStreamObjBase::alive, 0);
+}
+
+TEST_F(objectStreamTests, unconsumedObjectsAreNotCreated){
+    // the id range is endless, only the objects that are taken are created
+    auto ids = std::views::iota(0) | std::views::transform([](int i){ return 1 + i % 2; });
+    std::vector<int> values;
+    for (auto object : testStreamObjFactory::createStream(ids) | std::views::take(3)){
+        values.push_back(object->value());
+    }
+    ASSERT_EQ(values, std::vector<int>({1, 2, 1}));
+    ASSERT_EQ(testStreamObjBase::constructed, 3);
+
+    auto stream = testStreamObjFactory::createStream(std::vector<int>{1, 2});
+    ASSERT_EQ(testStreamObjBase::constructed, 3);
+}
+
+TEST_F(objectStreamTests, composesWithViews){
+    auto values = testStreamObjFactory::createStream(std::vector<int>{1, 2, 100, 2, 1, 2})
+                  | std::views::filter([](const auto& object){ return object != nullptr; })
+                  | std::views::transform([](auto object){ return object->value(); });
+    std::vector<int> collected;
+    std::ranges::copy(values, std::back_inserter(collected));
+    ASSERT_EQ(collected, std::vector<int>({1, 2, 2, 1, 2}));
+}
+
+TEST_F(objectStreamTests, registryChangesWhileStreaming){
+    std::vector<int> ids = {1, 1, 1, 4, 4};
+    auto stream = testStreamObjFactory::createStream(ids);
+    auto it = stream.begin();
+    ASSERT_NE(*it, nullptr);
+    // the cached creator function of id 1 is invalidated by the removal
+    ASSERT_TRUE(testStreamObjFactory::removeCreatorFunc(1));
+    ++it;
+    ASSERT_EQ(*it, nullptr);
+    ASSERT_TRUE(testStreamObjFactory::registerObject<testStreamObjB>(1));
+    ++it;
+    ASSERT_EQ((*it)->value(), 2);
+    // ids registered after the stream started are found
+    ++it;
+    ASSERT_EQ(*it, nullptr);
+    ASSERT_TRUE(testStreamObjFactory::registerObject<testStreamObjA>(4));
+    ++it;
+    ASSERT_EQ((*it)->value(), 1);
+    ++it;
+    ASSERT_EQ(it, stream.end());
+}
+
+TEST_F(objectStreamTests, throwingCreator){
+    std::vector<int> ids = {1, 3, 2};
+    auto stream = testStreamObjFactory::createStream(ids);
+    auto it = stream.begin();
+    ASSERT_EQ((*it)->value(), 1);
+    ++it;
+    ASSERT_THROW(static_cast<void>(it == stream.end()), std::runtime_error);
+    ASSERT_EQ(it, stream.end());
+
+    auto first = testStreamObjFactory::createStream(std::vector<int>{3});
+    auto firstIt = first.begin();
+    ASSERT_THROW(static_cast<void>(*firstIt), std::runtime_error);
+    ASSERT_EQ(firstIt, first.end());
+}
+
+TEST_F(objectStreamTests, argumentPairs){
+    std::vector<std::pair<int, int>> elements = {{1, 10}, {2, 20}, {2, 21}, {100, 0}};
+    std::vector<std::pair<int, int>> created;
+    for (auto object : testStreamObjArgFactory::createStream(elements)){
+        created.emplace_back(object ? object->value() : 0, object ? object->arg : 0);
+    }
+    std::vector<std::pair<int, int>> expected = {{1, 10}, {2, 20}, {2, 21}, {0, 0}};
+    ASSERT_EQ(created, expected);
+
+    auto args = std::views::iota(0, 4) | std::views::transform([](int i){ return std::pair(2, i); });
+    int sum = 0;
+    for (auto object : testStreamObjArgFactory::createStream(args)){
+        sum += object->arg;
+    }
+    ASSERT_EQ(sum, 6);
+}
+
+TEST_F(objectStreamTests, stringIDs){
+    ASSERT_TRUE(testStreamObjStringFactory::registerObject<testStreamObjStringBase>("base"));
+    std::vector<std::string> ids = {"base", "base", "other", "base"};
+    std::vector<bool> created;
+    for (auto object : testStreamObjStringFactory::createStream(ids)){
+        created.push_back(object != nullptr);
+    }
+    ASSERT_EQ(created, std::vector<bool>({true, true, false, true}));
+}
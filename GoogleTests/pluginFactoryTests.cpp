@@ -0,0 +1,91 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "pluginTestTypes.h"
+#include "../libFactoryPlugins.h"
+
+#include <gtest/gtest.h>
+
+#include <dlfcn.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef libFactory::PluginFactory<testPluginFactory> testLazyPluginFactory;
+
+static bool isTestPluginLoaded(){
+    void* handle = dlopen(LIBFACTORY_TEST_PLUGIN_PATH, RTLD_NOW | RTLD_NOLOAD);
+    if (handle){
+        dlclose(handle);
+    }
+    return handle != nullptr;
+}
+
+static std::string writeTestManifest(const std::string& name, const std::string& content){
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path) << content;
+    return path.string();
+}
+
+TEST(pluginFactoryTests, loadsOnFirstMiss){
+    auto manifest = writeTestManifest("libFactoryTestManifest.txt", std::string("# test plugin\n\npluginA ") + LIBFACTORY_TEST_PLUGIN_PATH + "\n  pluginB   " + LIBFACTORY_TEST_PLUGIN_PATH + "  \n");
+    ASSERT_TRUE(testLazyPluginFactory::loadManifest(manifest));
+    std::filesystem::remove(manifest);
+
+    // nothing is loaded at startup or by reading the manifest
+    ASSERT_FALSE(isTestPluginLoaded());
+    ASSERT_EQ(testPluginLoads, 0);
+    ASSERT_EQ(testPluginFactory::create("pluginA"), nullptr);
+
+    // concurrent misses load the plugin once
+    constexpr int threadCount = 8;
+    std::vector<int> values(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++){
+        threads.emplace_back([&values, t](){
+            auto ret = testLazyPluginFactory::create("pluginA");
+            values[t] = ret ? ret->value() : 0;
+        });
+    }
+    for (auto& thread : threads){
+        thread.join();
+    }
+    for (int value : values){
+        ASSERT_EQ(value, 1);
+    }
+    ASSERT_TRUE(isTestPluginLoaded());
+    ASSERT_EQ(testPluginLoads, 1);
+
+    // the other id of the same plugin was registered by the same load
+    auto ret = testLazyPluginFactory::create("pluginB");
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 2);
+    ASSERT_EQ(testPluginLoads, 1);
+    ASSERT_TRUE(testLazyPluginFactory::getPluginError("pluginA").empty());
+}
+
+TEST(pluginFactoryTests, unknownID){
+    ASSERT_EQ(testLazyPluginFactory::create("unknownPlugin"), nullptr);
+    ASSERT_FALSE(testLazyPluginFactory::loadPlugin("unknownPlugin"));
+}
+
+TEST(pluginFactoryTests, missingLibrary){
+    ASSERT_TRUE(testLazyPluginFactory::registerPlugin("missingPlugin", "libFactoryMissingPlugin.so"));
+    ASSERT_FALSE(testLazyPluginFactory::registerPlugin("missingPlugin", LIBFACTORY_TEST_PLUGIN_PATH));
+    ASSERT_TRUE(testLazyPluginFactory::getPluginError("missingPlugin").empty());
+    ASSERT_EQ(testLazyPluginFactory::create("missingPlugin"), nullptr);
+    ASSERT_FALSE(testLazyPluginFactory::getPluginError("missingPlugin").empty());
+    ASSERT_FALSE(testLazyPluginFactory::loadPlugin("missingPlugin"));
+}
+
+TEST(pluginFactoryTests, malformedManifest){
+    ASSERT_FALSE(testLazyPluginFactory::loadManifest("libFactoryMissingManifest.txt"));
+    auto manifest = writeTestManifest("libFactoryMalformedManifest.txt", "idWithoutPath\nvalidID libFactoryValidPlugin.so\n");
+    ASSERT_FALSE(testLazyPluginFactory::loadManifest(manifest));
+    std::filesystem::remove(manifest);
+    // the valid lines are still mapped
+    ASSERT_FALSE(testLazyPluginFactory::registerPlugin("validID", "libFactoryValidPlugin.so"));
+}
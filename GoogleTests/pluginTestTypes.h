@@ -0,0 +1,28 @@
+//
+// Created by elias on 16/10/2026.
+//
+
+#ifndef LIBFACTORY_PLUGINTESTTYPES_H
+#define LIBFACTORY_PLUGINTESTTYPES_H
+
+#include "../libFactory.h"
+
+#include <atomic>
+#include <string>
+
+// shared between pluginFactoryTests.cpp and the libFactoryTestPlugin shared object
+
+struct testPluginBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~testPluginBase() = default;
+    virtual int value() const = 0;
+};
+
+typedef libFactory::ConcurrentBasicFactory<testPluginBase> testPluginFactory;
+
+/**
+ * @brief incremented by the static initializers of the plugin, so the tests can see how often it was loaded
+ */
+inline std::atomic<int> testPluginLoads{0};
+
+#endif //LIBFACTORY_PLUGINTESTTYPES_H
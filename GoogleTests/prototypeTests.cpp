@@ -0,0 +1,112 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+struct testPrototypeBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~testPrototypeBase() = default;
+    virtual int value() const = 0;
+};
+
+struct testPrototypeCounted: public testPrototypeBase{
+    static inline int constructed = 0;
+    static inline int copied = 0;
+
+    explicit testPrototypeCounted(int a = 1) : a(a) { constructed++; }
+    testPrototypeCounted(const testPrototypeCounted& other) : testPrototypeBase(other), a(other.a) { copied++; }
+    int value() const override { return a; }
+    static std::string getFactoryID() { return "counted"; }
+
+    int a;
+};
+
+struct testPrototypeCloneable: public testPrototypeBase{
+    static inline int cloned = 0;
+
+    explicit testPrototypeCloneable(int a) : a(a) {}
+    int value() const override { return a; }
+    testPrototypeBase* clone() const {
+        cloned++;
+        return new testPrototypeCloneable(a * 2);
+    }
+
+    int a;
+};
+
+struct testPrototypeConstructed: public testPrototypeBase{
+    int value() const override { return 3; }
+};
+
+typedef libFactory::BasicFactory<testPrototypeBase> testPrototypeFactory;
+
+class prototypeTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        testPrototypeCounted::constructed = 0;
+        testPrototypeCounted::copied = 0;
+        testPrototypeCloneable::cloned = 0;
+    }
+
+    void TearDown() override {
+        testPrototypeFactory::clearRegistry();
+    }
+};
+
+TEST_F(prototypeTests, constructsOnce){
+    ASSERT_TRUE(testPrototypeFactory::registerPrototype<testPrototypeCounted>("counted", 42));
+    ASSERT_EQ(testPrototypeCounted::constructed, 1);
+
+    for (int i = 0; i < 10; i++){
+        auto ret = testPrototypeFactory::create("counted");
+        ASSERT_NE(ret, nullptr);
+        ASSERT_EQ(ret->value(), 42);
+    }
+    ASSERT_EQ(testPrototypeCounted::constructed, 1);
+    ASSERT_EQ(testPrototypeCounted::copied, 10);
+}
+
+TEST_F(prototypeTests, factoryID){
+    ASSERT_TRUE(testPrototypeFactory::registerPrototype<testPrototypeCounted>());
+    ASSERT_FALSE(testPrototypeFactory::registerPrototype<testPrototypeCounted>());
+    auto ret = testPrototypeFactory::create("counted");
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 1);
+}
+
+TEST_F(prototypeTests, usesClone){
+    ASSERT_TRUE(testPrototypeFactory::registerPrototype<testPrototypeCloneable>("clone", 4));
+    auto ret = testPrototypeFactory::create("clone");
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->value(), 8);
+    ASSERT_EQ(testPrototypeCloneable::cloned, 1);
+}
+
+TEST_F(prototypeTests, coexistsWithRegisterObject){
+    ASSERT_TRUE(testPrototypeFactory::registerPrototype<testPrototypeCounted>("counted", 5));
+    ASSERT_TRUE(testPrototypeFactory::registerObject<testPrototypeConstructed>("constructed"));
+    ASSERT_FALSE(testPrototypeFactory::registerObject<testPrototypeConstructed>("counted"));
+
+    ASSERT_EQ(testPrototypeFactory::create("counted")->value(), 5);
+    ASSERT_EQ(testPrototypeFactory::create("constructed")->value(), 3);
+
+    std::vector<std::string> ids{"counted", "constructed", "counted"};
+    auto batch = testPrototypeFactory::createBatch(ids);
+    ASSERT_EQ(batch.size(), 3);
+    ASSERT_EQ(batch[0]->value(), 5);
+    ASSERT_EQ(batch[1]->value(), 3);
+    ASSERT_EQ(batch[2]->value(), 5);
+    ASSERT_EQ(testPrototypeCounted::constructed, 1);
+}
+
+TEST_F(prototypeTests, sealed){
+    ASSERT_TRUE(testPrototypeFactory::registerPrototype<testPrototypeCounted>("counted", 7));
+    ASSERT_TRUE(testPrototypeFactory::seal());
+    ASSERT_FALSE(testPrototypeFactory::registerPrototype<testPrototypeCloneable>("clone", 1));
+    ASSERT_EQ(testPrototypeFactory::create("counted")->value(), 7);
+}
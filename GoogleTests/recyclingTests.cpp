@@ -0,0 +1,138 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+struct testRecycleBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~testRecycleBase() = default;
+    int value = 0;
+};
+
+struct testRecycleObject: public testRecycleBase{
+    testRecycleObject() { constructed++; buffer.reserve(16); }
+    ~testRecycleObject() override { destroyed++; }
+    void reset() { resets++; value = 0; buffer.clear(); }
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+    std::vector<int> buffer;
+    static inline int constructed = 0;
+    static inline int destroyed = 0;
+    static inline int resets = 0;
+};
+
+// only used by the threads of crossThreadRelease and threadExit, so the freelists of the main thread do not interfere
+struct testRecycleRemote: public testRecycleBase{
+    void reset() { value = 0; }
+};
+
+struct testRecycleThrowing: public testRecycleBase{
+    testRecycleThrowing() { throw std::runtime_error("testRecycleThrowing"); }
+    void reset() {}
+};
+
+typedef libFactory::BasicFactory<testRecycleBase, int, libFactory::FactoryPtr<testRecycleBase>> testRecycleFactory;
+typedef libFactory::ObjectRecycler<testRecycleObject> testRecycler;
+typedef libFactory::ObjectRecycler<testRecycleRemote> testRemoteRecycler;
+
+class recyclingTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testRecycleFactory::registerRecycledObject<testRecycleObject>());
+        ASSERT_TRUE(testRecycleFactory::registerRecycledObject<testRecycleRemote>(2));
+        ASSERT_TRUE(testRecycleFactory::registerRecycledObject<testRecycleThrowing>(3));
+        // objects earlier tests left on the freelist of this thread
+        initialFree = testRecycler::getFreeCount();
+        testRecycleObject::constructed = 0;
+        testRecycleObject::destroyed = 0;
+        testRecycleObject::resets = 0;
+    }
+
+    void TearDown() override {
+        testRecycleFactory::clearRegistry();
+    }
+
+    std::size_t initialFree = 0;
+};
+
+TEST_F(recyclingTests, reuseOnSameThread){
+    auto first = testRecycleFactory::create(1);
+    ASSERT_NE(first, nullptr);
+    std::size_t free = testRecycler::getFreeCount();
+    first->value = 5;
+    static_cast<testRecycleObject*>(first.get())->buffer.push_back(1);
+    testRecycleBase* address = first.get();
+    first.reset();
+    ASSERT_EQ(testRecycleObject::resets, 1);
+    ASSERT_EQ(testRecycleObject::destroyed, 0);
+    ASSERT_EQ(testRecycler::getFreeCount(), free + 1);
+
+    auto second = testRecycleFactory::create(1);
+    ASSERT_EQ(second.get(), address);
+    ASSERT_EQ(second->value, 0);
+    auto recycled = static_cast<testRecycleObject*>(second.get());
+    ASSERT_TRUE(recycled->buffer.empty());
+    ASSERT_GE(recycled->buffer.capacity(), 16);
+    ASSERT_LE(testRecycleObject::constructed, 1);
+    ASSERT_EQ(testRecycler::getFreeCount(), free);
+}
+
+TEST_F(recyclingTests, boundedFreelist){
+    std::size_t count = testRecycler::capacity + 10;
+    std::vector<libFactory::FactoryPtr<testRecycleBase>> objects;
+    for (std::size_t i = 0; i < count; i++){
+        objects.push_back(testRecycleFactory::create(1));
+    }
+    ASSERT_EQ(testRecycleObject::constructed, count - initialFree);
+    ASSERT_EQ(testRecycler::getFreeCount(), 0);
+    objects.clear();
+    ASSERT_EQ(testRecycleObject::resets, count);
+    ASSERT_EQ(testRecycler::getFreeCount(), testRecycler::capacity);
+    ASSERT_EQ(testRecycleObject::destroyed, 10);
+}
+
+TEST_F(recyclingTests, crossThreadRelease){
+    // objects made on one thread and released on another go back to the freelist of the thread that made them
+    std::thread owner([](){
+        std::vector<libFactory::FactoryPtr<testRecycleBase>> objects;
+        std::vector<testRecycleBase*> addresses;
+        for (int i = 0; i < 4; i++){
+            objects.push_back(testRecycleFactory::create(2));
+            addresses.push_back(objects.back().get());
+        }
+        std::thread releaser([&objects](){ objects.clear(); });
+        releaser.join();
+        ASSERT_EQ(testRemoteRecycler::getFreeCount(), 0);
+
+        auto reused = testRecycleFactory::create(2);
+        ASSERT_EQ(testRemoteRecycler::getFreeCount(), 3);
+        ASSERT_NE(std::find(addresses.begin(), addresses.end(), reused.get()), addresses.end());
+    });
+    owner.join();
+}
+
+TEST_F(recyclingTests, threadExit){
+    // objects released after the thread that made them exited are recycled by the next thread
+    libFactory::FactoryPtr<testRecycleBase> survivor;
+    std::thread maker([&survivor](){ survivor = testRecycleFactory::create(2); });
+    maker.join();
+    testRecycleBase* address = survivor.get();
+    survivor.reset();
+
+    std::thread next([address](){
+        auto reused = testRecycleFactory::create(2);
+        ASSERT_EQ(reused.get(), address);
+    });
+    next.join();
+}
+
+TEST_F(recyclingTests, throwingConstructor){
+    ASSERT_THROW(testRecycleFactory::create(3), std::runtime_error);
+    ASSERT_EQ(testRecycleFactory::create(100), nullptr);
+}
@@ -0,0 +1,129 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+struct testSealBase{
+    typedef int __factoryIdentifierType__;
+    testSealBase() = default;
+    explicit testSealBase(int a) : a(a) {}
+    virtual void incA(){a++;}
+    static int getFactoryID(){return 0;}
+    int a = 0;
+};
+
+struct testSealDerivA: public testSealBase{
+    testSealDerivA() = default;
+    explicit testSealDerivA(int a) : testSealBase(a) {}
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+};
+
+struct testSealDerivB: public testSealBase{
+    testSealDerivB() = default;
+    explicit testSealDerivB(int a) : testSealBase(a) {}
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+typedef libFactory::BasicFactory<testSealBase> testSealFactory;
+typedef libFactory::SingleArgumentFactory<testSealBase, int, int, std::unique_ptr<testSealBase>, libFactory::HashStorage> testSealSingleArgFactory;
+typedef libFactory::BasicFactory<testSealBase, std::string> testSealStringFactory;
+
+class sealedRegistryTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(testSealFactory::registerObject<testSealBase>());
+        ASSERT_TRUE(testSealFactory::registerObject<testSealDerivA>());
+        ASSERT_TRUE(testSealFactory::registerObject<testSealDerivB>());
+    }
+
+    void TearDown() override {
+        testSealFactory::clearRegistry();
+        testSealSingleArgFactory::clearRegistry();
+        testSealStringFactory::clearRegistry();
+    }
+};
+
+TEST_F(sealedRegistryTests, sealCreateObjects){
+    ASSERT_FALSE(testSealFactory::isSealed());
+    ASSERT_TRUE(testSealFactory::seal());
+    ASSERT_TRUE(testSealFactory::isSealed());
+
+    auto ret1 = testSealFactory::create(testSealBase::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 1);
+
+    auto ret2 = testSealFactory::create(testSealDerivA::getFactoryID());
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 2);
+
+    auto ret3 = testSealFactory::create(testSealDerivB::getFactoryID());
+    ASSERT_NE(ret3, nullptr);
+    ret3->incA();
+    ASSERT_EQ(ret3->a, 3);
+
+    ASSERT_EQ(testSealFactory::create(3), nullptr);
+    ASSERT_EQ(testSealFactory::create(-1), nullptr);
+}
+
+TEST_F(sealedRegistryTests, modifySealed){
+    ASSERT_TRUE(testSealFactory::seal());
+    ASSERT_FALSE(testSealFactory::seal());
+
+    ASSERT_FALSE(testSealFactory::registerObject<testSealDerivA>(5));
+    ASSERT_EQ(testSealFactory::create(5), nullptr);
+    ASSERT_FALSE(testSealFactory::removeCreatorFunc(testSealDerivA::getFactoryID()));
+    ASSERT_NE(testSealFactory::create(testSealDerivA::getFactoryID()), nullptr);
+}
+
+TEST_F(sealedRegistryTests, clearUnseals){
+    ASSERT_TRUE(testSealFactory::seal());
+    testSealFactory::clearRegistry();
+    ASSERT_FALSE(testSealFactory::isSealed());
+    ASSERT_EQ(testSealFactory::create(testSealDerivA::getFactoryID()), nullptr);
+
+    ASSERT_TRUE(testSealFactory::registerObject<testSealDerivA>());
+    ASSERT_NE(testSealFactory::create(testSealDerivA::getFactoryID()), nullptr);
+}
+
+TEST_F(sealedRegistryTests, sealEmpty){
+    testSealFactory::clearRegistry();
+    ASSERT_TRUE(testSealFactory::seal());
+    ASSERT_EQ(testSealFactory::create(0), nullptr);
+}
+
+TEST_F(sealedRegistryTests, sealManyIDs){
+    for (int i = 0; i < 10000; i++){
+        ASSERT_TRUE(testSealSingleArgFactory::registerObjectConstructor<testSealDerivB>(i * 3));
+    }
+    ASSERT_TRUE(testSealSingleArgFactory::seal());
+    for (int i = 0; i < 30000; i++){
+        auto ret = testSealSingleArgFactory::create(i, i);
+        if (i % 3 == 0){
+            ASSERT_NE(ret, nullptr);
+            ret->incA();
+            ASSERT_EQ(ret->a, i + 3);
+        }else{
+            ASSERT_EQ(ret, nullptr);
+        }
+    }
+}
+
+TEST_F(sealedRegistryTests, sealStringIDs){
+    ASSERT_TRUE(testSealStringFactory::registerObject<testSealDerivA>("derivA"));
+    ASSERT_TRUE(testSealStringFactory::registerObject<testSealDerivB>("derivB"));
+    ASSERT_TRUE(testSealStringFactory::seal());
+
+    ASSERT_NE(testSealStringFactory::create("derivA"), nullptr);
+    ASSERT_NE(testSealStringFactory::create("derivB"), nullptr);
+    ASSERT_EQ(testSealStringFactory::create("derivC"), nullptr);
+    ASSERT_EQ(testSealStringFactory::create(""), nullptr);
+}
@@ -0,0 +1,182 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct testSharedBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~testSharedBase() = default;
+    virtual int value() const = 0;
+};
+
+struct testSharedCounted: public testSharedBase{
+    static inline std::atomic<int> constructed{0};
+    static inline std::atomic<bool> gateOpen{true};
+
+    testSharedCounted(){
+        constructed++;
+        // widens the window in which other threads ask for the instance while it is being created
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        while (!gateOpen){
+            std::this_thread::yield();
+        }
+    }
+    int value() const override { return 1; }
+};
+
+struct testSharedOther: public testSharedBase{
+    int value() const override { return 2; }
+};
+
+struct testSharedThrowing: public testSharedBase{
+    static inline int attempts = 0;
+
+    testSharedThrowing(){
+        if (attempts++ == 0){
+            throw std::runtime_error("testSharedThrowing");
+        }
+    }
+    int value() const override { return 3; }
+};
+
+struct testSharedStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~testSharedStringBase() = default;
+};
+
+typedef libFactory::BasicFactory<testSharedBase> testSharedFactory;
+typedef libFactory::BasicFactory<testSharedStringBase> testSharedStringFactory;
+
+class sharedInstanceTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        testSharedCounted::constructed = 0;
+        ASSERT_TRUE(testSharedFactory::registerObject<testSharedCounted>(1));
+        ASSERT_TRUE(testSharedFactory::registerObject<testSharedOther>(2));
+        ASSERT_TRUE(testSharedFactory::registerObject<testSharedThrowing>(3));
+    }
+
+    void TearDown() override {
+        testSharedFactory::setSharingMode(testSharedFactory::sharingMode::strong);
+        testSharedFactory::clearSharedInstances();
+        testSharedFactory::clearRegistry();
+    }
+};
+
+TEST_F(sharedInstanceTests, singleInstance){
+    auto first = testSharedFactory::createShared(1);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first->value(), 1);
+    ASSERT_EQ(testSharedFactory::createShared(1), first);
+    ASSERT_NE(testSharedFactory::createShared(2), first);
+    ASSERT_EQ(testSharedFactory::createShared(2)->value(), 2);
+    ASSERT_EQ(testSharedCounted::constructed, 1);
+    ASSERT_EQ(testSharedFactory::getSharedInstanceCount(), 2);
+
+    // create() still makes a new object every time
+    ASSERT_NE(testSharedFactory::create(1).get(), first.get());
+    ASSERT_EQ(testSharedCounted::constructed, 2);
+
+    ASSERT_EQ(testSharedFactory::createShared(100), nullptr);
+    ASSERT_EQ(testSharedFactory::getSharedInstanceCount(), 2);
+}
+
+TEST_F(sharedInstanceTests, concurrentFirstAccess){
+    std::atomic<bool> start{false};
+    std::vector<std::shared_ptr<const testSharedBase>> instances(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < instances.size(); i++){
+        threads.emplace_back([&start, &instances, i](){
+            while (!start){
+                std::this_thread::yield();
+            }
+            instances[i] = testSharedFactory::createShared(1);
+        });
+    }
+    start = true;
+    for (auto& thread : threads){
+        thread.join();
+    }
+    ASSERT_EQ(testSharedCounted::constructed, 1);
+    for (const auto& instance : instances){
+        ASSERT_NE(instance, nullptr);
+        ASSERT_EQ(instance, instances[0]);
+    }
+}
+
+TEST_F(sharedInstanceTests, otherIDsNotBlocked){
+    // id 2 is created while the creation of id 1 is held up
+    testSharedCounted::gateOpen = false;
+    std::thread slow([](){ testSharedFactory::createShared(1); });
+    while (testSharedCounted::constructed == 0){
+        std::this_thread::yield();
+    }
+    auto other = std::async(std::launch::async, [](){ return testSharedFactory::createShared(2); });
+    bool finished = other.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+    testSharedCounted::gateOpen = true;
+    slow.join();
+    ASSERT_TRUE(finished);
+    ASSERT_NE(other.get(), nullptr);
+}
+
+TEST_F(sharedInstanceTests, weakMode){
+    testSharedFactory::setSharingMode(testSharedFactory::sharingMode::weak);
+    auto first = testSharedFactory::createShared(1);
+    ASSERT_EQ(testSharedFactory::createShared(1), first);
+    std::weak_ptr<const testSharedBase> released = first;
+    first.reset();
+    ASSERT_TRUE(released.expired());
+    ASSERT_EQ(testSharedFactory::getSharedInstanceCount(), 0);
+    ASSERT_NE(testSharedFactory::createShared(1), nullptr);
+    ASSERT_EQ(testSharedCounted::constructed, 2);
+
+    // switching to weak releases the instances that are only kept by the cache
+    testSharedFactory::setSharingMode(testSharedFactory::sharingMode::strong);
+    std::weak_ptr<const testSharedBase> strong = testSharedFactory::createShared(2);
+    ASSERT_FALSE(strong.expired());
+    testSharedFactory::setSharingMode(testSharedFactory::sharingMode::weak);
+    ASSERT_TRUE(strong.expired());
+}
+
+TEST_F(sharedInstanceTests, clearSharedInstances){
+    auto first = testSharedFactory::createShared(1);
+    testSharedFactory::clearSharedInstances();
+    ASSERT_EQ(testSharedFactory::getSharedInstanceCount(), 0);
+    auto second = testSharedFactory::createShared(1);
+    ASSERT_NE(second, first);
+    ASSERT_EQ(first->value(), 1);
+
+    // the cache is independent of the registry
+    ASSERT_TRUE(testSharedFactory::removeCreatorFunc(1));
+    ASSERT_EQ(testSharedFactory::createShared(1), second);
+}
+
+TEST_F(sharedInstanceTests, throwingCreator){
+    testSharedThrowing::attempts = 0;
+    ASSERT_THROW(testSharedFactory::createShared(3), std::runtime_error);
+    auto instance = testSharedFactory::createShared(3);
+    ASSERT_NE(instance, nullptr);
+    ASSERT_EQ(instance->value(), 3);
+    ASSERT_EQ(testSharedFactory::createShared(3), instance);
+}
+
+TEST_F(sharedInstanceTests, stringIDs){
+    ASSERT_TRUE(testSharedStringFactory::registerObject<testSharedStringBase>("base"));
+    std::string_view id = "base";
+    auto instance = testSharedStringFactory::createShared(id);
+    ASSERT_NE(instance, nullptr);
+    ASSERT_EQ(testSharedStringFactory::createShared("base"), instance);
+    testSharedStringFactory::clearSharedInstances();
+    testSharedStringFactory::clearRegistry();
+}
@@ -0,0 +1,98 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+struct testStatefulBase{
+    typedef int __factoryIdentifierType__;
+    testStatefulBase() = default;
+    explicit testStatefulBase(int a) : a(a) {}
+    virtual ~testStatefulBase() = default;
+    int a = 0;
+};
+
+struct testStatefulConfig{
+    int offset;
+    std::string name;
+};
+
+typedef libFactory::BasicFactory<testStatefulBase> testStatefulFactory;
+typedef libFactory::SingleArgumentFactory<testStatefulBase, int, int, std::unique_ptr<testStatefulBase>, libFactory::HashStorage> testStatefulSingleArgFactory;
+
+class statefulCreatorTests: public ::testing::Test {
+protected:
+    void TearDown() override {
+        testStatefulFactory::clearRegistry();
+        testStatefulSingleArgFactory::clearRegistry();
+    }
+};
+
+TEST_F(statefulCreatorTests, capturingLambda){
+    int value = 5;
+    ASSERT_TRUE(testStatefulFactory::registerCreatorFunc(1, [value](){ return std::make_unique<testStatefulBase>(value); }));
+    auto ret = testStatefulFactory::create(1);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 5);
+}
+
+TEST_F(statefulCreatorTests, sharedState){
+    auto config = std::make_shared<testStatefulConfig>(testStatefulConfig{10, "shared"});
+    ASSERT_TRUE(testStatefulSingleArgFactory::registerCreatorFunc(1, [config](int a){ return std::make_unique<testStatefulBase>(a + config->offset); }));
+    ASSERT_EQ(config.use_count(), 2);
+
+    config->offset = 20;
+    auto ret = testStatefulSingleArgFactory::create(1, 1);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 21);
+
+    // growing the hash storage copies and destroys the stored creators
+    for (int i = 2; i < 200; i++){
+        ASSERT_TRUE(testStatefulSingleArgFactory::registerCreatorFunc(i, [config](int a){ return std::make_unique<testStatefulBase>(a); }));
+    }
+    ASSERT_EQ(config.use_count(), 200);
+    ret = testStatefulSingleArgFactory::create(1, 2);
+    ASSERT_EQ(ret->a, 22);
+
+    ASSERT_TRUE(testStatefulSingleArgFactory::removeCreatorFunc(1));
+    ASSERT_EQ(config.use_count(), 199);
+    testStatefulSingleArgFactory::clearRegistry();
+    ASSERT_EQ(config.use_count(), 1);
+}
+
+TEST_F(statefulCreatorTests, functionPointer){
+    ASSERT_TRUE(testStatefulFactory::registerCreatorFunc(1, +[](){ return std::make_unique<testStatefulBase>(7); }));
+    auto ret = testStatefulFactory::create(1);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 7);
+}
+
+TEST_F(statefulCreatorTests, sealedStatefulCreator){
+    auto config = std::make_shared<testStatefulConfig>(testStatefulConfig{3, "sealed"});
+    ASSERT_TRUE(testStatefulFactory::registerCreatorFunc(1, [config](){ return std::make_unique<testStatefulBase>(config->offset); }));
+    ASSERT_TRUE(testStatefulFactory::seal());
+    auto ret = testStatefulFactory::create(1);
+    ASSERT_NE(ret, nullptr);
+    ASSERT_EQ(ret->a, 3);
+}
+
+TEST_F(statefulCreatorTests, inplaceCreatorCopies){
+    auto counter = std::make_shared<int>(0);
+    libFactory::InplaceCreator<int()> creator([counter](){ return ++*counter; });
+    ASSERT_TRUE(creator);
+    ASSERT_EQ(counter.use_count(), 2);
+    {
+        auto copy = creator;
+        ASSERT_EQ(counter.use_count(), 3);
+        ASSERT_EQ(copy(), 1);
+        ASSERT_EQ(creator(), 2);
+        copy = libFactory::InplaceCreator<int()>([](){ return 0; });
+        ASSERT_EQ(counter.use_count(), 2);
+        ASSERT_EQ(copy(), 0);
+    }
+    ASSERT_FALSE(libFactory::InplaceCreator<int()>());
+}
@@ -0,0 +1,127 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+struct testStaticBase{
+    typedef int __factoryIdentifierType__;
+    testStaticBase() = default;
+    explicit testStaticBase(int a) : a(a) {}
+    virtual void incA(){a++;}
+    static constexpr int getFactoryID(){return 0;}
+    int a = 0;
+};
+
+struct testStaticDerivA: public testStaticBase{
+    testStaticDerivA() = default;
+    explicit testStaticDerivA(int a) : testStaticBase(a) {}
+    void incA() override {a+=2;}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return 1;}
+};
+
+struct testStaticDerivB: public testStaticBase{
+    testStaticDerivB() = default;
+    explicit testStaticDerivB(int a) : testStaticBase(a) {}
+    void incA() override {a+=3;}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+struct testStaticSparse: public testStaticBase{
+    void incA() override {a+=4;}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return 1000;}
+};
+
+struct testStaticArgOnly: public testStaticBase{
+    explicit testStaticArgOnly(const std::string& s) : testStaticBase(static_cast<int>(s.size())) {}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return 3;}
+};
+
+enum class testStaticKind{first, second};
+
+struct testStaticEnumBase{
+    typedef testStaticKind __factoryIdentifierType__;
+    virtual int kind(){return -1;}
+};
+
+struct testStaticEnumFirst: public testStaticEnumBase{
+    int kind() override {return 1;}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return testStaticKind::first;}
+};
+
+struct testStaticEnumSecond: public testStaticEnumBase{
+    int kind() override {return 2;}
+    static constexpr __factoryIdentifierType__ getFactoryID(){return testStaticKind::second;}
+};
+
+typedef libFactory::StaticFactory<testStaticBase, testStaticBase, testStaticDerivA, testStaticDerivB> testStaticFactory;
+typedef libFactory::StaticFactory<testStaticBase, testStaticDerivA, testStaticSparse, testStaticArgOnly> testStaticSparseFactory;
+typedef libFactory::StaticFactory<testStaticEnumBase, testStaticEnumSecond, testStaticEnumFirst> testStaticEnumFactory;
+
+static_assert(testStaticFactory::contains(testStaticDerivB::getFactoryID()));
+static_assert(!testStaticFactory::contains(3));
+
+TEST(staticFactoryTests, createObjects){
+    auto ret1 = testStaticFactory::create(testStaticBase::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 1);
+
+    auto ret2 = testStaticFactory::create(testStaticDerivA::getFactoryID());
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 2);
+
+    auto ret3 = testStaticFactory::create(testStaticDerivB::getFactoryID());
+    ASSERT_NE(ret3, nullptr);
+    ret3->incA();
+    ASSERT_EQ(ret3->a, 3);
+}
+
+TEST(staticFactoryTests, unknownIDs){
+    ASSERT_EQ(testStaticFactory::create(-1), nullptr);
+    ASSERT_EQ(testStaticFactory::create(3), nullptr);
+    ASSERT_EQ(testStaticSparseFactory::create(0), nullptr);
+    ASSERT_EQ(testStaticSparseFactory::create(999), nullptr);
+}
+
+TEST(staticFactoryTests, createWithArgument){
+    auto ret1 = testStaticFactory::create(testStaticDerivA::getFactoryID(), 2);
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 4);
+
+    auto ret2 = testStaticFactory::create(testStaticDerivB::getFactoryID(), 3);
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 6);
+}
+
+TEST(staticFactoryTests, sparseIDs){
+    auto ret1 = testStaticSparseFactory::create(testStaticSparse::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 4);
+
+    // testStaticArgOnly is only constructible from a string
+    ASSERT_EQ(testStaticSparseFactory::create(testStaticArgOnly::getFactoryID()), nullptr);
+    auto ret2 = testStaticSparseFactory::create(testStaticArgOnly::getFactoryID(), std::string("abc"));
+    ASSERT_NE(ret2, nullptr);
+    ASSERT_EQ(ret2->a, 3);
+}
+
+TEST(staticFactoryTests, enumIDs){
+    auto ret1 = testStaticEnumFactory::create(testStaticKind::first);
+    ASSERT_NE(ret1, nullptr);
+    ASSERT_EQ(ret1->kind(), 1);
+
+    auto ret2 = testStaticEnumFactory::create(testStaticKind::second);
+    ASSERT_NE(ret2, nullptr);
+    ASSERT_EQ(ret2->kind(), 2);
+
+    ASSERT_EQ(testStaticEnumFactory::create(static_cast<testStaticKind>(7)), nullptr);
+}
@@ -0,0 +1,136 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct testStaticRegBase{
+    typedef int __factoryIdentifierType__;
+    virtual ~testStaticRegBase() = default;
+    virtual int value() const = 0;
+};
+
+typedef libFactory::BasicFactory<testStaticRegBase, int, std::unique_ptr<testStaticRegBase>, libFactory::FlatStorage> testStaticRegFactory;
+
+template<int id, int objectValue>
+struct testStaticRegObject: public testStaticRegBase, libFactory::staticRegister<testStaticRegFactory, testStaticRegObject<id, objectValue>>{
+    testStaticRegObject() { static_cast<void>(this->libFactory_bRegistered); }
+    int value() const override { return objectValue; }
+    static int getFactoryID(){ return id; }
+    static std::unique_ptr<testStaticRegBase> create(){ return std::make_unique<testStaticRegObject>(); }
+    static bool registered(){ return testStaticRegObject::libFactory_bRegistered; }
+};
+
+// the second registration of id 2 is dropped like a second autoRegister would be
+static bool (*const testStaticRegTypes[])() = {&testStaticRegObject<1, 10>::registered, &testStaticRegObject<2, 20>::registered, &testStaticRegObject<3, 30>::registered, &testStaticRegObject<2, 21>::registered};
+
+struct testStaticRegStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual ~testStaticRegStringBase() = default;
+};
+
+typedef libFactory::ConcurrentBasicFactory<testStaticRegStringBase> testStaticRegStringFactory;
+
+struct testStaticRegStringObject: public testStaticRegStringBase, libFactory::staticRegister<testStaticRegStringFactory, testStaticRegStringObject>{
+    testStaticRegStringObject() { static_cast<void>(libFactory_bRegistered); }
+    static std::string getFactoryID(){ return "stringObject"; }
+    static std::unique_ptr<testStaticRegStringBase> create(){ return std::make_unique<testStaticRegStringObject>(); }
+};
+
+TEST(staticRegistrationTests, registeredOnFirstUse){
+    for (auto registered : testStaticRegTypes){
+        ASSERT_TRUE(registered());
+    }
+    for (int id = 1; id <= 3; id++){
+        auto ret = testStaticRegFactory::create(id);
+        ASSERT_NE(ret, nullptr);
+        ASSERT_EQ(ret->value(), id * 10);
+    }
+    ASSERT_EQ(testStaticRegFactory::create(4), nullptr);
+}
+
+TEST(staticRegistrationTests, pendingIDsAreTaken){
+    ASSERT_FALSE(testStaticRegFactory::registerCreatorFunc(1, [](){ return std::unique_ptr<testStaticRegBase>(); }));
+}
+
+TEST(staticRegistrationTests, objectInfoIsRecorded){
+    ASSERT_EQ(testStaticRegFactory::maxObjectSize(), sizeof(testStaticRegObject<1, 10>));
+    alignas(std::max_align_t) std::byte buffer[64];
+    auto placed = testStaticRegFactory::createInto(3, buffer, sizeof(buffer));
+    ASSERT_TRUE(placed);
+    ASSERT_EQ(placed.object->value(), 30);
+    placed.destroy(placed.object);
+}
+
+TEST(staticRegistrationTests, concurrentFirstUse){
+    std::vector<std::thread> threads;
+    std::vector<bool> created(8);
+    for (std::size_t t = 0; t < created.size(); t++){
+        threads.emplace_back([&created, t](){ created[t] = testStaticRegStringFactory::create("stringObject") != nullptr; });
+    }
+    for (auto& thread : threads){
+        thread.join();
+    }
+    for (bool ret : created){
+        ASSERT_TRUE(ret);
+    }
+}
+
+template<class storage>
+class insertBulkTests: public ::testing::Test {};
+
+template<class identifierType, class valueType>
+using testBulkConcurrentStorage = libFactory::ConcurrentStorage<identifierType, valueType, libFactory::FlatStorage>;
+
+typedef ::testing::Types<libFactory::MapStorage<int, int>, libFactory::FlatStorage<int, int>, libFactory::HashStorage<int, int>, libFactory::DenseStorage<int, int>, testBulkConcurrentStorage<int, int>> insertBulkStorageTypes;
+TYPED_TEST_SUITE(insertBulkTests, insertBulkStorageTypes);
+
+TYPED_TEST(insertBulkTests, insertBulk){
+    TypeParam storage;
+    ASSERT_TRUE(storage.insert(5, 50));
+    ASSERT_TRUE(storage.insert(1, 10));
+
+    std::vector<std::pair<int, int>> values;
+    for (int i = 100; i > 0; i--){
+        values.emplace_back(i, i * 100);
+    }
+    values.emplace_back(50, 0);
+    ASSERT_EQ(storage.insertBulk(values), 98);
+    ASSERT_EQ(storage.size(), 100);
+
+    // existing values and the first of duplicated ids are kept
+    ASSERT_EQ(*storage.find(5), 50);
+    ASSERT_EQ(*storage.find(1), 10);
+    ASSERT_EQ(*storage.find(50), 5000);
+    for (int i = 1; i <= 100; i++){
+        ASSERT_TRUE(storage.find(i));
+    }
+    ASSERT_FALSE(storage.find(101));
+    ASSERT_EQ(storage.insertBulk({}), 0);
+}
+
+TYPED_TEST(insertBulkTests, insertBulkSorted){
+    TypeParam storage;
+    ASSERT_TRUE(storage.insert(1, 10));
+
+    // already ordered values after the existing ids, with a duplicate next to its first occurrence
+    std::vector<std::pair<int, int>> values = {{2, 20}, {3, 30}, {3, 0}, {4, 40}};
+    ASSERT_EQ(storage.insertBulk(values), 3);
+    ASSERT_EQ(storage.size(), 4);
+    ASSERT_EQ(*storage.find(1), 10);
+    ASSERT_EQ(*storage.find(3), 30);
+    ASSERT_EQ(*storage.find(4), 40);
+
+    // ordered values in front of the existing ids still get merged
+    values = {{-1, -10}, {0, 0}};
+    ASSERT_EQ(storage.insertBulk(values), 2);
+    ASSERT_EQ(*storage.find(-1), -10);
+    ASSERT_EQ(*storage.find(1), 10);
+    ASSERT_EQ(storage.size(), 6);
+}
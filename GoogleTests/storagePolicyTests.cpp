@@ -0,0 +1,125 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+struct testStorageBase{
+    typedef int __factoryIdentifierType__;
+    testStorageBase() = default;
+    explicit testStorageBase(int a) : a(a) {}
+    virtual void incA(){a++;}
+    static int getFactoryID(){return 0;}
+    int a = 0;
+};
+
+struct testStorageDerivA: public testStorageBase{
+    testStorageDerivA() = default;
+    explicit testStorageDerivA(int a) : testStorageBase(a) {}
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return 1;}
+};
+
+struct testStorageDerivB: public testStorageBase{
+    testStorageDerivB() = default;
+    explicit testStorageDerivB(int a) : testStorageBase(a) {}
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return 2;}
+};
+
+template<template<class, class> class registryStorage>
+struct storagePolicy{
+    typedef libFactory::BasicFactory<testStorageBase, int, std::unique_ptr<testStorageBase>, registryStorage> basicFactory;
+    typedef libFactory::SingleArgumentFactory<testStorageBase, int, int, std::unique_ptr<testStorageBase>, registryStorage> singleArgFactory;
+};
+
+template<class policy>
+class storagePolicyTests: public ::testing::Test {
+protected:
+    typedef typename policy::basicFactory basicFactory;
+    typedef typename policy::singleArgFactory singleArgFactory;
+
+    void SetUp() override {
+        ASSERT_TRUE(basicFactory::template registerObject<testStorageBase>());
+        ASSERT_TRUE(basicFactory::template registerObject<testStorageDerivA>());
+        ASSERT_TRUE(basicFactory::template registerObject<testStorageDerivB>());
+        ASSERT_TRUE(singleArgFactory::template registerObjectConstructor<testStorageBase>());
+        ASSERT_TRUE(singleArgFactory::template registerObjectConstructor<testStorageDerivA>());
+        ASSERT_TRUE(singleArgFactory::template registerObjectConstructor<testStorageDerivB>());
+    }
+
+    void TearDown() override {
+        basicFactory::clearRegistry();
+        singleArgFactory::clearRegistry();
+    }
+};
+
+typedef ::testing::Types<storagePolicy<libFactory::MapStorage>, storagePolicy<libFactory::FlatStorage>, storagePolicy<libFactory::HashStorage>, storagePolicy<libFactory::DenseStorage>> storagePolicyTypes;
+TYPED_TEST_SUITE(storagePolicyTests, storagePolicyTypes);
+
+TYPED_TEST(storagePolicyTests, createObjects){
+    auto ret1 = TestFixture::basicFactory::create(testStorageBase::getFactoryID());
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 1);
+
+    auto ret2 = TestFixture::basicFactory::create(testStorageDerivA::getFactoryID());
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 2);
+
+    auto ret3 = TestFixture::singleArgFactory::create(testStorageDerivB::getFactoryID(), 3);
+    ASSERT_NE(ret3, nullptr);
+    ret3->incA();
+    ASSERT_EQ(ret3->a, 6);
+}
+
+TYPED_TEST(storagePolicyTests, reRegistration){
+    ASSERT_FALSE(TestFixture::basicFactory::template registerObject<testStorageBase>());
+    ASSERT_FALSE(TestFixture::singleArgFactory::template registerObjectConstructor<testStorageBase>());
+}
+
+TYPED_TEST(storagePolicyTests, clearRegistrations){
+    TestFixture::basicFactory::clearRegistry();
+    TestFixture::singleArgFactory::clearRegistry();
+    ASSERT_EQ(TestFixture::basicFactory::create(0), nullptr);
+    ASSERT_EQ(TestFixture::singleArgFactory::create(0, 0), nullptr);
+
+    ASSERT_TRUE(TestFixture::basicFactory::template registerObject<testStorageDerivA>(0));
+    ASSERT_NE(TestFixture::basicFactory::create(0), nullptr);
+}
+
+TYPED_TEST(storagePolicyTests, removeRegistrations){
+    ASSERT_TRUE(TestFixture::basicFactory::removeCreatorFunc(testStorageDerivA::getFactoryID()));
+    ASSERT_FALSE(TestFixture::basicFactory::removeCreatorFunc(testStorageDerivA::getFactoryID()));
+    ASSERT_EQ(TestFixture::basicFactory::create(testStorageDerivA::getFactoryID()), nullptr);
+    ASSERT_NE(TestFixture::basicFactory::create(testStorageBase::getFactoryID()), nullptr);
+    ASSERT_NE(TestFixture::basicFactory::create(testStorageDerivB::getFactoryID()), nullptr);
+
+    ASSERT_TRUE(TestFixture::singleArgFactory::removeCreatorFunc(testStorageBase::getFactoryID()));
+    ASSERT_EQ(TestFixture::singleArgFactory::create(testStorageBase::getFactoryID(), 0), nullptr);
+    ASSERT_NE(TestFixture::singleArgFactory::create(testStorageDerivA::getFactoryID(), 0), nullptr);
+}
+
+TYPED_TEST(storagePolicyTests, manyRegistrations){
+    TestFixture::basicFactory::clearRegistry();
+
+    // enough ids to force several rehashes and collisions in the hash storage
+    for (int i = 0; i < 1000; i++){
+        ASSERT_TRUE(TestFixture::basicFactory::template registerObject<testStorageDerivA>(i * 64));
+    }
+    for (int i = 0; i < 1000; i += 2){
+        ASSERT_TRUE(TestFixture::basicFactory::removeCreatorFunc(i * 64));
+    }
+    for (int i = 0; i < 1000; i++){
+        if (i % 2 == 0){
+            ASSERT_EQ(TestFixture::basicFactory::create(i * 64), nullptr);
+        }else{
+            ASSERT_NE(TestFixture::basicFactory::create(i * 64), nullptr);
+        }
+    }
+    ASSERT_EQ(TestFixture::basicFactory::create(1), nullptr);
+}
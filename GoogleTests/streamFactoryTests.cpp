@@ -0,0 +1,213 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactoryStream.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+struct testStreamBase{
+    typedef int __factoryIdentifierType__;
+    explicit testStreamBase(std::span<const std::byte> payload) : source(payload.data()), size(payload.size()) {
+        for (std::byte value : payload){
+            sum += static_cast<int>(value);
+        }
+    }
+    virtual ~testStreamBase() = default;
+    const std::byte* source;
+    std::size_t size;
+    int sum = 0;
+};
+
+struct testStreamObject: public testStreamBase{
+    using testStreamBase::testStreamBase;
+};
+
+struct testStreamOther: public testStreamBase{
+    using testStreamBase::testStreamBase;
+};
+
+struct testStreamThrowing: public testStreamBase{
+    explicit testStreamThrowing(std::span<const std::byte> payload) : testStreamBase(payload) { throw std::runtime_error("testStreamThrowing"); }
+};
+
+typedef libFactory::StreamFactory<libFactory::SingleArgumentFactory<testStreamBase, std::span<const std::byte>>> testStreamFactory;
+typedef libFactory::StreamFactory<libFactory::SingleArgumentFactory<testStreamBase, std::span<const std::byte>, std::string>> testStreamStringFactory;
+
+static std::vector<std::byte> testStreamPayload(std::size_t size, int value){
+    return std::vector<std::byte>(size, static_cast<std::byte>(value));
+}
+
+class streamFactoryTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / ("libFactoryStreamTests" + std::to_string(::getpid()) + ".records")).string();
+        ASSERT_TRUE(testStreamFactory::registerObjectConstructor<testStreamObject>(1));
+        ASSERT_TRUE(testStreamFactory::registerObjectConstructor<testStreamOther>(2));
+        ASSERT_TRUE(testStreamFactory::registerObjectConstructor<testStreamThrowing>(3));
+    }
+
+    void TearDown() override {
+        testStreamFactory::clearRegistry();
+        testStreamStringFactory::clearRegistry();
+        std::filesystem::remove(path);
+    }
+
+    // writes count records with ids 1 and 2 alternating, record i has i bytes of payload with the value i
+    void writeRecords(int count){
+        libFactory::RecordWriter<int> writer(path);
+        ASSERT_TRUE(writer.valid());
+        for (int i = 0; i < count; i++){
+            ASSERT_TRUE(writer.write(1 + i % 2, testStreamPayload(static_cast<std::size_t>(i), i)));
+        }
+        ASSERT_TRUE(writer.close());
+    }
+
+    std::string path;
+};
+
+TEST_F(streamFactoryTests, lazyIteration){
+    writeRecords(10);
+    auto stream = testStreamFactory::readRecords(path);
+    ASSERT_TRUE(stream.valid());
+    ASSERT_TRUE(stream.complete());
+
+    auto bytes = stream.getRecords().bytes();
+    int i = 0;
+    for (auto it = stream.begin(); it != stream.end(); ++it, ++i){
+        ASSERT_EQ(it.getRecord().id, 1 + i % 2);
+        auto object = *it;
+        ASSERT_NE(object, nullptr);
+        if (i % 2 == 0){
+            ASSERT_NE(dynamic_cast<testStreamObject*>(object.get()), nullptr);
+        }else{
+            ASSERT_NE(dynamic_cast<testStreamOther*>(object.get()), nullptr);
+        }
+        ASSERT_EQ(object->size, static_cast<std::size_t>(i));
+        ASSERT_EQ(object->sum, i * i);
+        // the payload is handed to the creator straight out of the mapping
+        if (i != 0){
+            ASSERT_GE(object->source, bytes.data());
+            ASSERT_LE(object->source + object->size, bytes.data() + bytes.size());
+        }
+    }
+    ASSERT_EQ(i, 10);
+    static_assert(std::input_iterator<testStreamFactory::recordStream::iterator>);
+    static_assert(std::forward_iterator<testStreamFactory::recordRangeType::iterator>);
+}
+
+TEST_F(streamFactoryTests, unknownIDs){
+    {
+        libFactory::RecordWriter<int> writer(path);
+        ASSERT_TRUE(writer.write(1, testStreamPayload(4, 1)));
+        ASSERT_TRUE(writer.write(100, testStreamPayload(4, 1)));
+        ASSERT_TRUE(writer.write(2, testStreamPayload(4, 1)));
+        ASSERT_TRUE(writer.close());
+    }
+    auto stream = testStreamFactory::readRecords(path);
+    std::vector<bool> created;
+    for (auto object : stream){
+        created.push_back(object != nullptr);
+    }
+    ASSERT_EQ(created, std::vector<bool>({true, false, true}));
+}
+
+TEST_F(streamFactoryTests, truncatedAndMissingFiles){
+    writeRecords(5);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    auto stream = testStreamFactory::readRecords(path);
+    ASSERT_TRUE(stream.valid());
+    ASSERT_FALSE(stream.complete());
+    // iteration stops in front of the cut off record
+    ASSERT_EQ(std::distance(stream.getRecords().begin(), stream.getRecords().end()), 4);
+    ASSERT_EQ(stream.createAll(2).size(), 4);
+
+    std::filesystem::resize_file(path, 0);
+    auto empty = testStreamFactory::readRecords(path);
+    ASSERT_TRUE(empty.valid());
+    ASSERT_TRUE(empty.complete());
+    ASSERT_EQ(empty.begin(), empty.end());
+    ASSERT_TRUE(empty.createAll(4).empty());
+
+    std::filesystem::remove(path);
+    auto missing = testStreamFactory::readRecords(path);
+    ASSERT_FALSE(missing.valid());
+    ASSERT_EQ(missing.begin(), missing.end());
+}
+
+TEST_F(streamFactoryTests, createAll){
+    writeRecords(1000);
+    auto stream = testStreamFactory::readRecords(path);
+    for (std::size_t threadCount : {1, 3, 8, 0}){
+        auto objects = stream.createAll(threadCount);
+        ASSERT_EQ(objects.size(), 1000);
+        for (std::size_t i = 0; i < objects.size(); i++){
+            ASSERT_NE(objects[i], nullptr);
+            ASSERT_EQ(objects[i]->size, i);
+        }
+    }
+
+    // more threads than records
+    {
+        libFactory::RecordWriter<int> writer(path);
+        ASSERT_TRUE(writer.write(2, testStreamPayload(3, 1)));
+        ASSERT_TRUE(writer.close());
+    }
+    auto single = testStreamFactory::readRecords(path);
+    ASSERT_EQ(single.createAll(16).size(), 1);
+}
+
+TEST_F(streamFactoryTests, createAllException){
+    {
+        libFactory::RecordWriter<int> writer(path);
+        for (int i = 0; i < 100; i++){
+            ASSERT_TRUE(writer.write(i == 90 ? 3 : 1, testStreamPayload(8, i)));
+        }
+        ASSERT_TRUE(writer.close());
+    }
+    auto stream = testStreamFactory::readRecords(path);
+    ASSERT_THROW(stream.createAll(4), std::runtime_error);
+    ASSERT_THROW(stream.createAll(1), std::runtime_error);
+}
+
+TEST_F(streamFactoryTests, stringIDs){
+    ASSERT_TRUE(testStreamStringFactory::registerObjectConstructor<testStreamObject>("object"));
+    {
+        libFactory::RecordWriter<std::string> writer(path);
+        ASSERT_TRUE(writer.write("object", testStreamPayload(2, 3)));
+        ASSERT_TRUE(writer.write("", testStreamPayload(0, 0)));
+        ASSERT_TRUE(writer.write("object", testStreamPayload(1, 5)));
+        ASSERT_TRUE(writer.close());
+    }
+    auto stream = testStreamStringFactory::readRecords(path);
+    ASSERT_TRUE(stream.complete());
+    auto objects = stream.createAll();
+    ASSERT_EQ(objects.size(), 3);
+    ASSERT_EQ(objects[0]->sum, 6);
+    ASSERT_EQ(objects[1], nullptr);
+    ASSERT_EQ(objects[2]->sum, 5);
+    ASSERT_EQ(stream.getRecords().begin()->id, "object");
+}
+
+TEST_F(streamFactoryTests, inMemoryRecords){
+    writeRecords(4);
+    libFactory::MappedFile file(path);
+    ASSERT_TRUE(file.valid());
+    std::vector<std::byte> copy(file.data().begin(), file.data().end());
+    file.close();
+    ASSERT_FALSE(file.valid());
+
+    auto stream = testStreamFactory::readRecords(copy);
+    ASSERT_TRUE(stream.valid());
+    ASSERT_EQ(stream.createAll().size(), 4);
+    ASSERT_EQ((*std::next(stream.begin(), 3))->sum, 9);
+}
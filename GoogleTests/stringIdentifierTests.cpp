@@ -0,0 +1,97 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "../libFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+struct testStringBase{
+    typedef std::string __factoryIdentifierType__;
+    virtual void incA(){a++;}
+    static std::string getFactoryID(){return "base";}
+    int a = 0;
+};
+
+struct testStringDerivA: public testStringBase{
+    void incA() override {a+=2;}
+    static __factoryIdentifierType__ getFactoryID(){return "a long identifier that does not fit into the small string buffer";}
+};
+
+struct testStringDerivB: public testStringBase{
+    void incA() override {a+=3;}
+    static __factoryIdentifierType__ getFactoryID(){return "b";}
+};
+
+template<template<class, class> class registryStorage>
+struct stringStoragePolicy{
+    typedef libFactory::BasicFactory<testStringBase, std::string, std::unique_ptr<testStringBase>, registryStorage> factory;
+};
+
+template<class policy>
+class stringIdentifierTests: public ::testing::Test {
+protected:
+    typedef typename policy::factory factory;
+
+    void SetUp() override {
+        ASSERT_TRUE(factory::template registerObject<testStringBase>());
+        ASSERT_TRUE(factory::template registerObject<testStringDerivA>());
+        ASSERT_TRUE(factory::template registerObject<testStringDerivB>());
+    }
+
+    void TearDown() override {
+        factory::clearRegistry();
+    }
+};
+
+typedef ::testing::Types<stringStoragePolicy<libFactory::MapStorage>, stringStoragePolicy<libFactory::FlatStorage>, stringStoragePolicy<libFactory::HashStorage>, stringStoragePolicy<libFactory::ConcurrentStorage>> stringStoragePolicyTypes;
+TYPED_TEST_SUITE(stringIdentifierTests, stringStoragePolicyTypes);
+
+TYPED_TEST(stringIdentifierTests, createFromLiteral){
+    auto ret1 = TestFixture::factory::create("base");
+    ASSERT_NE(ret1, nullptr);
+    ret1->incA();
+    ASSERT_EQ(ret1->a, 1);
+
+    auto ret2 = TestFixture::factory::create("a long identifier that does not fit into the small string buffer");
+    ASSERT_NE(ret2, nullptr);
+    ret2->incA();
+    ASSERT_EQ(ret2->a, 2);
+
+    ASSERT_EQ(TestFixture::factory::create("c"), nullptr);
+}
+
+TYPED_TEST(stringIdentifierTests, createFromStringView){
+    std::string_view id = "bb";
+    ASSERT_NE(TestFixture::factory::create(id.substr(1)), nullptr);
+    ASSERT_EQ(TestFixture::factory::create(id), nullptr);
+}
+
+TYPED_TEST(stringIdentifierTests, createFromString){
+    std::string id = testStringDerivB::getFactoryID();
+    auto ret = TestFixture::factory::create(id);
+    ASSERT_NE(ret, nullptr);
+    ret->incA();
+    ASSERT_EQ(ret->a, 3);
+}
+
+TYPED_TEST(stringIdentifierTests, registerAndRemoveFromView){
+    std::string_view id = "view registered";
+    ASSERT_TRUE(TestFixture::factory::template registerObject<testStringDerivB>(id));
+    ASSERT_FALSE(TestFixture::factory::template registerObject<testStringDerivB>("view registered"));
+    ASSERT_NE(TestFixture::factory::create(std::string("view registered")), nullptr);
+
+    ASSERT_TRUE(TestFixture::factory::removeCreatorFunc("view registered"));
+    ASSERT_FALSE(TestFixture::factory::removeCreatorFunc(id));
+    ASSERT_EQ(TestFixture::factory::create(id), nullptr);
+}
+
+TYPED_TEST(stringIdentifierTests, sealedLookup){
+    ASSERT_TRUE(TestFixture::factory::seal());
+    ASSERT_NE(TestFixture::factory::create("b"), nullptr);
+    ASSERT_NE(TestFixture::factory::create(std::string_view("base")), nullptr);
+    ASSERT_EQ(TestFixture::factory::create("bas"), nullptr);
+}
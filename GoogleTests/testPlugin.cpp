@@ -0,0 +1,31 @@
+//
+// Created by elias on 16/10/2026.
+//
+#include "pluginTestTypes.h"
+
+#include <memory>
+
+// built as the libFactoryTestPlugin module, pluginFactoryTests.cpp loads it on the first create() of one of its ids
+
+struct testPluginObjectA: public testPluginBase, libFactory::autoRegister<testPluginFactory, testPluginObjectA>{
+    testPluginObjectA();
+    int value() const override { return 1; }
+    static std::string getFactoryID(){ return "pluginA"; }
+    static std::unique_ptr<testPluginBase> create(){ return std::make_unique<testPluginObjectA>(); }
+};
+
+struct testPluginObjectB: public testPluginBase, libFactory::autoRegister<testPluginFactory, testPluginObjectB>{
+    testPluginObjectB();
+    int value() const override { return 2; }
+    static std::string getFactoryID(){ return "pluginB"; }
+    static std::unique_ptr<testPluginBase> create(){ return std::make_unique<testPluginObjectB>(); }
+};
+
+// the constructors are defined out of line so the registration is instantiated even though nothing in the plugin creates the objects
+testPluginObjectA::testPluginObjectA() { static_cast<void>(libFactory_bRegistered); }
+testPluginObjectB::testPluginObjectB() { static_cast<void>(libFactory_bRegistered); }
+
+static const bool testPluginLoaded = [](){
+    testPluginLoads++;
+    return true;
+}();
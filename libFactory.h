@@ -4,113 +4,3674 @@
 #include <map>
 #include <memory>
 #include <iostream>
+#include <vector>
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <limits>
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <span>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <bit>
+#include <compare>
+#include <coroutine>
+#include <exception>
+#include <ranges>
 
 /**
  * @brief namespace for library classes and functions
  */
 namespace libFactory{
 
+    /**
+     * @brief describes how identifiers are passed to lookups and how they are hashed
+     *
+     * @details
+     * lookups take identifiers as viewType so that looking up an id never has to construct an identifierType,
+     * for std::basic_string identifiers viewType is the matching std::basic_string_view so create("name") does not allocate a temporary string, for every other type it is a const reference
+     *
+     * specialize this for your own identifier types if they have a cheaper non owning form, viewType has to be comparable with identifierType and hash() has to return the same value for an identifierType and its viewType
+     *
+     * @tparam identifierType the type of the identifier
+     */
+    template<class identifierType>
+    struct IdentifierTraits{
+        /**
+         * @brief the type used to pass identifiers to lookups
+         */
+        typedef const identifierType& viewType;
+
+        /**
+         * @brief function to hash an identifier
+         * @param id the identifier to hash
+         * @return the hash of the identifier
+         */
+        static std::size_t hash(viewType id){
+            return std::hash<identifierType>{}(id);
+        }
+    };
+
+    template<class charType, class charTraits, class allocatorType>
+    struct IdentifierTraits<std::basic_string<charType, charTraits, allocatorType>>{
+        typedef std::basic_string_view<charType, charTraits> viewType;
+
+        static std::size_t hash(viewType id){
+            return std::hash<viewType>{}(id);
+        }
+    };
+
+    /**
+     * @brief the type used to pass an identifier to lookups, see libFactory::IdentifierTraits
+     */
+    template<class identifierType>
+    using IdentifierView = typename IdentifierTraits<identifierType>::viewType;
+
+    /**
+     * @brief identifier that is a 64 bit hash of a name and keeps the name for diagnostics
+     *
+     * @details
+     * the name is hashed with 64 bit FNV-1a, in a constant expression at compile time, so types can be named by strings but the registry only ever compares and hashes integers.
+     * ids are equal and ordered by their hash only, the name is not looked at by lookups.
+     * two different names with the same hash are a collision, registering the second one fails and is recorded by the factory (see libFactory::FactoryBase::getCollisions())
+     *
+     * @code
+     * struct tcpHandler: public handler{
+     *     static constexpr libFactory::FactoryId getFactoryID(){ return "tcp_handler"; }
+     * };
+     * auto ret = handlerFactory::create("tcp_handler");
+     * @endcode
+     *
+     * @warning the id only points to its name, the name has to outlive the id, which string literals always do
+     */
+    class FactoryId{
+    public:
+        /**
+         * @brief constructs the id of the empty name
+         */
+        constexpr FactoryId() : FactoryId(std::string_view()) {}
+
+        /**
+         * @brief constructs the id of a name, implicit so string literals can be passed wherever an id is expected
+         * @param name the name, has to outlive the id
+         */
+        constexpr FactoryId(const char* name) : FactoryId(std::string_view(name)) {} // NOLINT(google-explicit-constructor)
+
+        /**
+         * @brief constructs the id of a name
+         * @param name the name, has to outlive the id
+         */
+        constexpr explicit FactoryId(std::string_view name) : value(hash(name)), name(name) {}
+
+        /**
+         * @brief function to make an id from a hash without a name, for example to look up an id that was stored as its hash
+         * @param value the hash
+         * @return the id, its name is empty
+         */
+        static constexpr FactoryId fromValue(std::uint64_t value){
+            FactoryId ret;
+            ret.value = value;
+            return ret;
+        }
+
+        /**
+         * @brief function to hash a name with 64 bit FNV-1a
+         * @param name the name to hash
+         * @return the hash of the name
+         */
+        static constexpr std::uint64_t hash(std::string_view name){
+            std::uint64_t ret = 0xcbf29ce484222325ull;
+            for (char c : name){
+                ret ^= static_cast<unsigned char>(c);
+                ret *= 0x100000001b3ull;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to get the hash of the id
+         * @return the hash
+         */
+        constexpr std::uint64_t getValue() const{
+            return value;
+        }
+
+        /**
+         * @brief function to get the name of the id
+         * @return the name, empty if the id was made with fromValue()
+         */
+        constexpr std::string_view getName() const{
+            return name;
+        }
+
+        friend constexpr bool operator==(const FactoryId& lhs, const FactoryId& rhs){
+            return lhs.value == rhs.value;
+        }
+
+        friend constexpr std::strong_ordering operator<=>(const FactoryId& lhs, const FactoryId& rhs){
+            return lhs.value <=> rhs.value;
+        }
+    private:
+        std::uint64_t value;
+        std::string_view name;
+    };
+
+    template<>
+    struct IdentifierTraits<FactoryId>{
+        typedef const FactoryId& viewType;
+
+        static std::size_t hash(viewType id){
+            return static_cast<std::size_t>(id.getValue());
+        }
+
+        /**
+         * @brief function to check if two equal ids are a hash collision of two different names
+         * @details identifier types whose equality can be a collision implement this, the factories then record registrations that failed because of a collision (see libFactory::FactoryBase::getCollisions())
+         * @param stored the id in the registry
+         * @param id the id that was registered
+         * @return true if the names differ, ids without a name never collide
+         */
+        static bool collides(viewType stored, viewType id){
+            return !stored.getName().empty() && !id.getName().empty() && stored.getName() != id.getName();
+        }
+    };
+
+    /**
+     * @brief registry storage policy backed by a std::map
+     *
+     * @details
+     * this is the default registry storage for non integral identifiers (see libFactory::AutoStorage), lookups are a O(log n) tree walk
+     *
+     * all storage policies implement the same interface: find(), insert(), erase(), clear() and size(), if you want to write your own storage policy then implement these functions with the same semantics
+     *
+     * @tparam identifierType the type of the identifier used as key
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    class MapStorage{
+    public:
+        /**
+         * @brief function to find a value in the storage
+         * @param id the id to look for
+         * @return pointer to the stored value
+         * @return nullptr if the id does not exist in the storage
+         */
+        const valueType* find(IdentifierView<identifierType> id) const{
+            if (auto it = map.find(id); it != map.end()){
+                return &it->second;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief function to insert a value into the storage
+         * @param id the id to store the value under
+         * @param value the value to store
+         * @return true if the value was inserted
+         * @return false if the id already exists in the storage
+         */
+        bool insert(IdentifierView<identifierType> id, const valueType& value){
+            if (map.find(id) != map.end()){
+                return false;
+            }
+            map.emplace(identifierType(id), value);
+            return true;
+        }
+
+        /**
+         * @brief function to insert many values into the storage at once
+         * @param values the ids and values to insert, for ids that already exist in the storage or appear more than once only the first value is kept
+         * @return the amount of inserted values
+         */
+        std::size_t insertBulk(std::span<const std::pair<identifierType, valueType>> values){
+            std::size_t ret = 0;
+            for (const auto& [id, value] : values){
+                ret += map.try_emplace(id, value).second ? 1 : 0;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to erase a value from the storage
+         * @param id the id of the value to erase
+         * @return true if the value was erased
+         * @return false if the id does not exist in the storage
+         */
+        bool erase(IdentifierView<identifierType> id){
+            if (auto it = map.find(id); it != map.end()){
+                map.erase(it);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief function to remove all values from the storage
+         */
+        void clear(){
+            map.clear();
+        }
+
+        /**
+         * @brief function to get the amount of values in the storage
+         * @return the amount of values in the storage
+         */
+        std::size_t size() const{
+            return map.size();
+        }
+
+        /**
+         * @brief function to call a function for every stored id and value
+         * @param func the function to call, gets called as func(id, value)
+         */
+        template<class function>
+        void forEach(function&& func) const{
+            for (const auto& [id, value] : map){
+                func(id, value);
+            }
+        }
+    private:
+        std::map<identifierType, valueType, std::less<>> map;
+    };
+
+    /**
+     * @brief registry storage policy backed by a contiguous sorted vector
+     *
+     * @details
+     * lookups are a binary search over contiguous memory, which is a lot more cache friendly than a tree walk, inserting and erasing are O(n) so this is best suited for registries that are filled once and then only read
+     *
+     * @tparam identifierType the type of the identifier used as key, has to be less than comparable
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    class FlatStorage{
+    public:
+        /**
+         * @brief function to find a value in the storage
+         * @param id the id to look for
+         * @return pointer to the stored value
+         * @return nullptr if the id does not exist in the storage
+         */
+        const valueType* find(IdentifierView<identifierType> id) const{
+            if (auto it = lowerBound(id); it != entries.end() && !(id < it->first)){
+                return &it->second;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief function to insert a value into the storage
+         * @param id the id to store the value under
+         * @param value the value to store
+         * @return true if the value was inserted
+         * @return false if the id already exists in the storage
+         */
+        bool insert(IdentifierView<identifierType> id, const valueType& value){
+            auto it = lowerBound(id);
+            if (it != entries.end() && !(id < it->first)){
+                return false;
+            }
+            entries.emplace(it, identifierType(id), value);
+            return true;
+        }
+
+        /**
+         * @brief function to insert many values into the storage at once
+         * @details the new values are sorted on their own and merged into the storage, which is O(n log n) instead of the O(n^2) of inserting them one by one
+         * @param values the ids and values to insert, for ids that already exist in the storage or appear more than once only the first value is kept
+         * @return the amount of inserted values
+         */
+        std::size_t insertBulk(std::span<const std::pair<identifierType, valueType>> values){
+            auto byID = [](const auto& a, const auto& b){ return a.first < b.first; };
+            std::size_t oldSize = entries.size();
+            entries.reserve(oldSize + values.size());
+            for (const auto& value : values){
+                auto it = std::lower_bound(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(oldSize), value, byID);
+                if (it == entries.begin() + static_cast<std::ptrdiff_t>(oldSize) || value.first < it->first){
+                    entries.push_back(value);
+                }
+            }
+            auto added = entries.begin() + static_cast<std::ptrdiff_t>(oldSize);
+            // values that are already in order (registrations of generated types usually are) skip the sort and the merge
+            if (!std::is_sorted(added, entries.end(), byID)){
+                std::stable_sort(added, entries.end(), byID);
+            }
+            entries.erase(std::unique(added, entries.end(), [](const auto& a, const auto& b){ return !(a.first < b.first) && !(b.first < a.first); }), entries.end());
+            added = entries.begin() + static_cast<std::ptrdiff_t>(oldSize);
+            if (added != entries.begin() && added != entries.end() && added->first < std::prev(added)->first){
+                std::inplace_merge(entries.begin(), added, entries.end(), byID);
+            }
+            return entries.size() - oldSize;
+        }
+
+        /**
+         * @brief function to erase a value from the storage
+         * @param id the id of the value to erase
+         * @return true if the value was erased
+         * @return false if the id does not exist in the storage
+         */
+        bool erase(IdentifierView<identifierType> id){
+            if (auto it = lowerBound(id); it != entries.end() && !(id < it->first)){
+                entries.erase(it);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief function to remove all values from the storage
+         */
+        void clear(){
+            entries.clear();
+        }
+
+        /**
+         * @brief function to get the amount of values in the storage
+         * @return the amount of values in the storage
+         */
+        std::size_t size() const{
+            return entries.size();
+        }
+
+        /**
+         * @brief function to call a function for every stored id and value
+         * @param func the function to call, gets called as func(id, value)
+         */
+        template<class function>
+        void forEach(function&& func) const{
+            for (const auto& [id, value] : entries){
+                func(id, value);
+            }
+        }
+    private:
+        typedef std::vector<std::pair<identifierType, valueType>> entryVectorType;
+
+        typename entryVectorType::const_iterator lowerBound(IdentifierView<identifierType> id) const{
+            return std::lower_bound(entries.begin(), entries.end(), id, [](const auto& entry, IdentifierView<identifierType> key){ return entry.first < key; });
+        }
+
+        typename entryVectorType::iterator lowerBound(IdentifierView<identifierType> id){
+            return std::lower_bound(entries.begin(), entries.end(), id, [](const auto& entry, IdentifierView<identifierType> key){ return entry.first < key; });
+        }
+
+        entryVectorType entries;
+    };
+
+    /**
+     * @brief registry storage policy backed by an open addressing hash table
+     *
+     * @details
+     * uses linear probing over a power of two sized table with backward shift deletion, so there are no tombstones and lookups stay short even after a lot of removals
+     *
+     * @tparam identifierType the type of the identifier used as key, has to be hashable with std::hash and equality comparable
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    class HashStorage{
+    public:
+        /**
+         * @brief function to find a value in the storage
+         * @param id the id to look for
+         * @return pointer to the stored value
+         * @return nullptr if the id does not exist in the storage
+         */
+        const valueType* find(IdentifierView<identifierType> id) const{
+            if (slots.empty()){
+                return nullptr;
+            }
+            for (std::size_t i = homeSlot(id);; i = (i + 1) & mask){
+                const auto& slot = slots[i];
+                if (!slot){
+                    return nullptr;
+                }
+                if (slot->first == id){
+                    return &slot->second;
+                }
+            }
+        }
+
+        /**
+         * @brief function to insert a value into the storage
+         * @param id the id to store the value under
+         * @param value the value to store
+         * @return true if the value was inserted
+         * @return false if the id already exists in the storage
+         */
+        bool insert(IdentifierView<identifierType> id, const valueType& value){
+            if (find(id)){
+                return false;
+            }
+            if ((count + 1) * 2 > slots.size()){ // keep the load factor at or below 0.5
+                rehash(slots.empty() ? 16 : slots.size() * 2);
+            }
+            place(identifierType(id), value);
+            count++;
+            return true;
+        }
+
+        /**
+         * @brief function to insert many values into the storage at once
+         * @details the table is grown once up front instead of rehashing while the values are inserted
+         * @param values the ids and values to insert, for ids that already exist in the storage or appear more than once only the first value is kept
+         * @return the amount of inserted values
+         */
+        std::size_t insertBulk(std::span<const std::pair<identifierType, valueType>> values){
+            std::size_t newSize = slots.empty() ? 16 : slots.size();
+            while ((count + values.size()) * 2 > newSize){
+                newSize *= 2;
+            }
+            if (newSize != slots.size()){
+                rehash(newSize);
+            }
+            std::size_t ret = 0;
+            for (const auto& [id, value] : values){
+                ret += insert(id, value) ? 1 : 0;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to erase a value from the storage
+         * @param id the id of the value to erase
+         * @return true if the value was erased
+         * @return false if the id does not exist in the storage
+         */
+        bool erase(IdentifierView<identifierType> id){
+            if (slots.empty()){
+                return false;
+            }
+            std::size_t hole = homeSlot(id);
+            for (;; hole = (hole + 1) & mask){
+                if (!slots[hole]){
+                    return false;
+                }
+                if (slots[hole]->first == id){
+                    break;
+                }
+            }
+            slots[hole].reset();
+            count--;
+
+            // backward shift the following entries of the probe sequence into the hole
+            for (std::size_t i = (hole + 1) & mask; slots[i]; i = (i + 1) & mask){
+                std::size_t home = homeSlot(slots[i]->first);
+                if (((i - home) & mask) >= ((i - hole) & mask)){
+                    slots[hole] = std::move(slots[i]);
+                    slots[i].reset();
+                    hole = i;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief function to remove all values from the storage
+         */
+        void clear(){
+            slots.clear();
+            mask = 0;
+            count = 0;
+        }
+
+        /**
+         * @brief function to get the amount of values in the storage
+         * @return the amount of values in the storage
+         */
+        std::size_t size() const{
+            return count;
+        }
+
+        /**
+         * @brief function to call a function for every stored id and value
+         * @param func the function to call, gets called as func(id, value)
+         */
+        template<class function>
+        void forEach(function&& func) const{
+            for (const auto& slot : slots){
+                if (slot){
+                    func(slot->first, slot->second);
+                }
+            }
+        }
+    private:
+        std::size_t homeSlot(IdentifierView<identifierType> id) const{
+            // fibonacci hashing so that weak hashes (std::hash<int> is the identity) still spread over the table
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(IdentifierTraits<identifierType>::hash(id)) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        }
+
+        void place(identifierType id, const valueType& value){
+            std::size_t i = homeSlot(id);
+            while (slots[i]){
+                i = (i + 1) & mask;
+            }
+            slots[i].emplace(std::move(id), value);
+        }
+
+        void rehash(std::size_t newSize){
+            auto oldSlots = std::move(slots);
+            slots = slotVectorType(newSize);
+            mask = newSize - 1;
+            for (auto& slot : oldSlots){
+                if (slot){
+                    place(std::move(slot->first), slot->second);
+                }
+            }
+        }
+
+        typedef std::vector<std::optional<std::pair<identifierType, valueType>>> slotVectorType;
+
+        slotVectorType slots;
+        std::size_t mask = 0;
+        std::size_t count = 0;
+    };
+
+    /**
+     * @brief registry storage policy backed by a table that is directly indexed by the id
+     *
+     * @details
+     * for integral and enum identifiers, a lookup is one subtraction, a bounds check and an array read.
+     * the table covers the range between the smallest and the largest stored id and grows as ids are inserted, as long as that range stays dense (see denseFactor and minimumTableSize),
+     * ids that would make the table too sparse (for example a single id of 1000000 next to ids 0 to 50) are kept in a std::map fallback instead and moved into the table once it grows over them
+     *
+     * the table grows geometrically like a std::vector, so registering ids one by one in any order is amortized O(1) for ids in the table and O(log n) for the ones in the fallback
+     *
+     * @tparam identifierType the type of the identifier used as key, has to be an integral or enum type
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    class DenseStorage{
+        static_assert(std::is_integral_v<identifierType> || std::is_enum_v<identifierType>, "libFactory::DenseStorage: the identifier type has to be an integral or enum type, use libFactory::AutoStorage to fall back to libFactory::MapStorage for other types");
+    public:
+        /**
+         * @brief the table may span at most denseFactor slots per stored id
+         */
+        static constexpr std::size_t denseFactor = 4;
+
+        /**
+         * @brief the table may always span this many slots, no matter how few ids are stored
+         */
+        static constexpr std::size_t minimumTableSize = 64;
+
+        /**
+         * @brief function to find a value in the storage
+         * @param id the id to look for
+         * @return pointer to the stored value
+         * @return nullptr if the id does not exist in the storage
+         */
+        const valueType* find(IdentifierView<identifierType> id) const{
+            // ids below the table wrap around to huge indices, so one compare checks both bounds
+            if (std::uint64_t index = toKey(id) - lowKey; index < table.size()){
+                return table[index] ? &*table[index] : nullptr;
+            }
+            if (outliers.empty()){
+                return nullptr;
+            }
+            auto it = outliers.find(id);
+            return it != outliers.end() ? &it->second : nullptr;
+        }
+
+        /**
+         * @brief function to insert a value into the storage
+         * @param id the id to store the value under
+         * @param value the value to store
+         * @return true if the value was inserted
+         * @return false if the id already exists in the storage
+         */
+        bool insert(IdentifierView<identifierType> id, const valueType& value){
+            if (find(id)){
+                return false;
+            }
+            std::uint64_t key = toKey(id);
+            if (!coverRange(key, key, 1)){
+                return outliers.emplace(id, value).second;
+            }
+            table[key - lowKey].emplace(value);
+            tableCount++;
+            return true;
+        }
+
+        /**
+         * @brief function to insert many values into the storage at once
+         * @details the table is grown once to cover all values if the result is dense enough, otherwise the values are inserted one by one and the sparse ones go to the fallback
+         * @param values the ids and values to insert, for ids that already exist in the storage or appear more than once only the first value is kept
+         * @return the amount of inserted values
+         */
+        std::size_t insertBulk(std::span<const std::pair<identifierType, valueType>> values){
+            if (!values.empty()){
+                auto [first, last] = std::minmax_element(values.begin(), values.end(), [](const auto& a, const auto& b){ return toKey(a.first) < toKey(b.first); });
+                coverRange(toKey(first->first), toKey(last->first), values.size());
+            }
+            std::size_t ret = 0;
+            for (const auto& [id, value] : values){
+                ret += insert(id, value) ? 1 : 0;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to erase a value from the storage
+         * @param id the id of the value to erase
+         * @return true if the value was erased
+         * @return false if the id does not exist in the storage
+         */
+        bool erase(IdentifierView<identifierType> id){
+            if (std::uint64_t index = toKey(id) - lowKey; index < table.size()){
+                if (!table[index]){
+                    return false;
+                }
+                table[index].reset();
+                if (--tableCount == 0){
+                    // start over at the next inserted id instead of keeping the old range
+                    table.clear();
+                }
+                return true;
+            }
+            return outliers.erase(id) != 0;
+        }
+
+        /**
+         * @brief function to remove all values from the storage
+         */
+        void clear(){
+            table.clear();
+            tableCount = 0;
+            lowKey = 0;
+            outliers.clear();
+        }
+
+        /**
+         * @brief function to get the amount of values in the storage
+         * @return the amount of values in the storage
+         */
+        std::size_t size() const{
+            return tableCount + outliers.size();
+        }
+
+        /**
+         * @brief function to call a function for every stored id and value
+         * @note the ids in the table are visited first, then the ones in the fallback
+         * @param func the function to call, gets called as func(id, value)
+         */
+        template<class function>
+        void forEach(function&& func) const{
+            for (std::size_t i = 0; i < table.size(); i++){
+                if (table[i]){
+                    func(fromKey(lowKey + i), *table[i]);
+                }
+            }
+            for (const auto& [id, value] : outliers){
+                func(id, value);
+            }
+        }
+    private:
+        typedef typename std::conditional_t<std::is_enum_v<identifierType>, std::underlying_type<identifierType>, std::type_identity<identifierType>>::type integerType;
+
+        // maps the id to an unsigned key with the same order, signed ids are offset so that negative ids come first
+        static constexpr std::uint64_t signOffset = std::is_signed_v<integerType> ? std::uint64_t(1) << 63 : 0;
+
+        static std::uint64_t toKey(identifierType id){
+            if constexpr (std::is_signed_v<integerType>){
+                return static_cast<std::uint64_t>(static_cast<std::int64_t>(static_cast<integerType>(id))) ^ signOffset;
+            }else{
+                return static_cast<std::uint64_t>(static_cast<integerType>(id));
+            }
+        }
+
+        static identifierType fromKey(std::uint64_t key){
+            if constexpr (std::is_signed_v<integerType>){
+                return static_cast<identifierType>(static_cast<integerType>(static_cast<std::int64_t>(key ^ signOffset)));
+            }else{
+                return static_cast<identifierType>(static_cast<integerType>(key));
+            }
+        }
+
+        /**
+         * @brief grows the table so it covers the keys first to last, if the table is still dense enough once added more ids are stored in it
+         * @return true if the table covers the keys
+         */
+        bool coverRange(std::uint64_t first, std::uint64_t last, std::size_t added){
+            std::uint64_t newLow = first;
+            std::uint64_t newHigh = last;
+            if (!table.empty()){
+                std::uint64_t high = lowKey + (table.size() - 1);
+                if (first >= lowKey && last <= high){
+                    return true;
+                }
+                newLow = std::min(newLow, lowKey);
+                newHigh = std::max(newHigh, high);
+            }
+            // compare the span minus one so the full 64 bit range does not overflow
+            std::uint64_t limit = std::max(minimumTableSize, denseFactor * (tableCount + added));
+            if (newHigh - newLow >= limit){
+                return false;
+            }
+            // grow by at least the current size in the direction of the new keys, so inserting ids one by one does not move the table every time
+            std::uint64_t spare = std::min<std::uint64_t>(limit - 1 - (newHigh - newLow), table.size());
+            if (!table.empty() && newLow < lowKey){
+                newLow -= std::min(spare, newLow - toKey(static_cast<identifierType>(std::numeric_limits<integerType>::min())));
+            }else if (!table.empty()){
+                newHigh += std::min(spare, toKey(static_cast<identifierType>(std::numeric_limits<integerType>::max())) - newHigh);
+            }
+            std::size_t newSize = static_cast<std::size_t>(newHigh - newLow) + 1;
+            if (!table.empty() && newLow < lowKey){
+                table.insert(table.begin(), static_cast<std::size_t>(lowKey - newLow), std::nullopt);
+            }
+            table.resize(newSize);
+            lowKey = newLow;
+            adoptOutliers();
+            return true;
+        }
+
+        /**
+         * @brief moves the fallback ids the table covers now into the table, so find() never has to look at the fallback for ids in the table range
+         */
+        void adoptOutliers(){
+            // the keys keep the order of the ids, so the covered ids are one range of the map
+            auto first = outliers.lower_bound(fromKey(lowKey));
+            auto last = first;
+            for (; last != outliers.end() && toKey(last->first) - lowKey < table.size(); ++last){
+                table[toKey(last->first) - lowKey].emplace(std::move(last->second));
+                tableCount++;
+            }
+            outliers.erase(first, last);
+        }
+
+        std::vector<std::optional<valueType>> table;
+        std::uint64_t lowKey = 0;
+        std::size_t tableCount = 0;
+        std::map<identifierType, valueType> outliers;
+    };
+
+    /**
+     * @brief registry storage policy that picks libFactory::DenseStorage for integral and enum identifiers and libFactory::MapStorage for everything else, this is the default registry storage of the factories
+     * @tparam identifierType the type of the identifier used as key
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    using AutoStorage = std::conditional_t<std::is_integral_v<identifierType> || std::is_enum_v<identifierType>, DenseStorage<identifierType, valueType>, MapStorage<identifierType, valueType>>;
+
+    /**
+     * @brief immutable registry indexed by a perfect hash function
+     *
+     * @details
+     * built once from the contents of a registry, the ids are spread over a slot table with a hash and displace scheme so that no two ids share a slot,
+     * a lookup is therefore always one hash, two table reads and a single key compare no matter how many ids are stored
+     *
+     * the stored values are kept in one contiguous array with exactly one element per id
+     *
+     * @tparam identifierType the type of the identifier used as key, has to be hashable with std::hash and equality comparable
+     * @tparam valueType the type of the stored value
+     */
+    template<class identifierType, class valueType>
+    class SealedRegistry{
+    public:
+        /**
+         * @brief function to build the index from a registry storage
+         * @param storage the storage to copy the ids and values from, has to implement forEach()
+         * @return true if the index was built
+         * @return false if two different ids have the same hash value and can therefore not be separated
+         */
+        template<class storageType>
+        bool build(const storageType& storage){
+            entries.clear();
+            entries.reserve(storage.size());
+            storage.forEach([this](const identifierType& id, const valueType& value){ entries.emplace_back(id, value); });
+
+            std::vector<std::uint64_t> hashes(entries.size());
+            for (std::size_t i = 0; i < entries.size(); i++){
+                hashes[i] = mix(IdentifierTraits<identifierType>::hash(entries[i].first));
+            }
+
+            // with 64 bit hashes this only fails if the id hash function itself collides
+            for (std::size_t slotCount = ceilPowerOfTwo(entries.size() + entries.size() / 4 + 1); slotCount <= (ceilPowerOfTwo(entries.size() + 1) << 4); slotCount <<= 1){
+                if (tryBuild(hashes, slotCount)){
+                    return true;
+                }
+            }
+            entries.clear();
+            seeds.assign(1, 0);
+            slots.assign(1, 0);
+            bucketMask = 0;
+            slotMask = 0;
+            return false;
+        }
+
+        /**
+         * @brief function to find a value in the index
+         * @param id the id to look for
+         * @return pointer to the stored value
+         * @return nullptr if the id does not exist in the index
+         */
+        const valueType* find(IdentifierView<identifierType> id) const{
+            if (entries.empty()){
+                return nullptr;
+            }
+            const std::uint64_t hash = mix(IdentifierTraits<identifierType>::hash(id));
+            const auto& entry = entries[slots[slotOf(hash, seeds[hash & bucketMask])]];
+            if (entry.first == id){
+                return &entry.second;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief function to get the amount of values in the index
+         * @return the amount of values in the index
+         */
+        std::size_t size() const{
+            return entries.size();
+        }
+    private:
+        static std::uint64_t mix(std::uint64_t hash){
+            // splitmix64 finalizer
+            hash ^= hash >> 30;
+            hash *= 0xBF58476D1CE4E5B9ull;
+            hash ^= hash >> 27;
+            hash *= 0x94D049BB133111EBull;
+            hash ^= hash >> 31;
+            return hash;
+        }
+
+        static std::size_t ceilPowerOfTwo(std::size_t value){
+            std::size_t ret = 1;
+            while (ret < value){
+                ret <<= 1;
+            }
+            return ret;
+        }
+
+        std::size_t slotOf(std::uint64_t hash, std::uint32_t seed) const{
+            return static_cast<std::size_t>(mix(hash + seed * 0x9E3779B97F4A7C15ull) >> 16) & slotMask;
+        }
+
+        bool tryBuild(const std::vector<std::uint64_t>& hashes, std::size_t slotCount){
+            constexpr std::uint32_t maxSeed = 1u << 16;
+            const std::size_t bucketCount = ceilPowerOfTwo(entries.size() / 2 + 1);
+            bucketMask = bucketCount - 1;
+            slotMask = slotCount - 1;
+
+            std::vector<std::vector<std::uint32_t>> buckets(bucketCount);
+            for (std::uint32_t i = 0; i < hashes.size(); i++){
+                buckets[hashes[i] & bucketMask].push_back(i);
+            }
+            std::vector<std::uint32_t> order(bucketCount);
+            for (std::uint32_t i = 0; i < bucketCount; i++){
+                order[i] = i;
+            }
+            // place the largest buckets first while the table is still mostly empty
+            std::stable_sort(order.begin(), order.end(), [&buckets](std::uint32_t a, std::uint32_t b){ return buckets[a].size() > buckets[b].size(); });
+
+            seeds.assign(bucketCount, 0);
+            std::vector<bool> taken(slotCount, false);
+            // empty slots point at entry 0, an id that is not stored can never match it since entry 0 lives in its own slot
+            slots.assign(slotCount, 0);
+            std::vector<std::size_t> placed;
+            for (std::uint32_t bucket : order){
+                if (buckets[bucket].empty()){
+                    break;
+                }
+                bool found = false;
+                for (std::uint32_t seed = 0; seed < maxSeed && !found; seed++){
+                    placed.clear();
+                    found = true;
+                    for (std::uint32_t entry : buckets[bucket]){
+                        std::size_t slot = slotOf(hashes[entry], seed);
+                        if (taken[slot] || std::find(placed.begin(), placed.end(), slot) != placed.end()){
+                            found = false;
+                            break;
+                        }
+                        placed.push_back(slot);
+                    }
+                    if (found){
+                        seeds[bucket] = seed;
+                        for (std::size_t i = 0; i < placed.size(); i++){
+                            taken[placed[i]] = true;
+                            slots[placed[i]] = buckets[bucket][i];
+                        }
+                    }
+                }
+                if (!found){
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::vector<std::pair<identifierType, valueType>> entries;
+        std::vector<std::uint32_t> seeds = std::vector<std::uint32_t>(1, 0);
+        std::vector<std::uint32_t> slots = std::vector<std::uint32_t>(1, 0);
+        std::size_t bucketMask = 0;
+        std::size_t slotMask = 0;
+    };
+
+    /**
+     * @brief thread safe registry storage policy where lookups never block
+     *
+     * @details
+     * the registry contents live in an immutable snapshot (stored in snapshotStorage) that is published through an atomic pointer,
+     * readers announce themselves in a per thread slot and then read the current snapshot without taking any lock, so find() is wait free and can run concurrently with insert(), erase() and clear()
+     * writers are serialized by a mutex, copy the current snapshot, modify the copy and publish it with an atomic pointer swap,
+     * the replaced snapshot is retired and only deleted once every reader that could still see it has left (epoch based reclamation)
+     *
+     * find() returns a libFactory::ConcurrentStorage::readGuard instead of a plain pointer, the snapshot it points into stays alive until the guard is destroyed
+     *
+     * @note every modification copies the whole snapshot, so this is meant for registries that are read a lot more than they are modified
+     * @tparam identifierType the type of the identifier used as key
+     * @tparam valueType the type of the stored value
+     * @tparam snapshotStorage the storage policy used for the snapshots, uses libFactory::HashStorage if not defined
+     * @see GoogleTests/concurrentStorageTests.cpp
+     */
+    template<class identifierType, class valueType, template<class, class> class snapshotStorage = HashStorage>
+    class ConcurrentStorage{
+        typedef snapshotStorage<identifierType, valueType> snapshotType;
+
+        /**
+         * @brief per thread reader announcement, epoch is idleEpoch while the thread is not reading
+         */
+        struct readerSlot{
+            std::atomic<std::uint64_t> epoch{idleEpoch};
+            std::atomic<bool> inUse{true};
+            unsigned depth = 0;
+            readerSlot* next = nullptr;
+        };
+    public:
+        /**
+         * @brief pointer like handle to a value found in the storage that keeps the snapshot it points into alive
+         */
+        class readGuard{
+        public:
+            /**
+             * @brief creates a guard for a value that does not need protection, used for values that are never reclaimed
+             * @param value the value to point to, can be nullptr
+             */
+            readGuard(const valueType* value = nullptr) : value(value) {} // NOLINT(google-explicit-constructor)
+
+            readGuard(readGuard&& other) noexcept : value(other.value), slot(other.slot) {
+                other.slot = nullptr;
+            }
+
+            readGuard(const readGuard&) = delete;
+            readGuard& operator=(const readGuard&) = delete;
+            readGuard& operator=(readGuard&&) = delete;
+
+            ~readGuard(){
+                if (slot){
+                    leave(*slot);
+                }
+            }
+
+            explicit operator bool() const{
+                return value != nullptr;
+            }
+
+            const valueType& operator*() const{
+                return *value;
+            }
+
+            const valueType* operator->() const{
+                return value;
+            }
+        private:
+            friend class ConcurrentStorage;
+
+            readGuard(const valueType* value, readerSlot* slot) : value(value), slot(slot) {}
+
+            const valueType* value;
+            readerSlot* slot = nullptr;
+        };
+
+        ConcurrentStorage() = default;
+        ConcurrentStorage(const ConcurrentStorage&) = delete;
+        ConcurrentStorage& operator=(const ConcurrentStorage&) = delete;
+
+        ~ConcurrentStorage(){
+            delete current.load();
+            for (auto& retiredSnapshot : retired){
+                delete retiredSnapshot.first;
+            }
+        }
+
+        /**
+         * @brief function to find a value in the storage, wait free
+         * @param id the id to look for
+         * @return guard pointing to the stored value
+         * @return an empty guard if the id does not exist in the storage
+         */
+        readGuard find(IdentifierView<identifierType> id) const{
+            readerSlot& slot = enter();
+            return readGuard(current.load(std::memory_order_seq_cst)->find(id), &slot);
+        }
+
+        /**
+         * @brief function to insert a value into the storage
+         * @param id the id to store the value under
+         * @param value the value to store
+         * @return true if the value was inserted
+         * @return false if the id already exists in the storage
+         */
+        bool insert(IdentifierView<identifierType> id, const valueType& value){
+            std::lock_guard lock(writeMutex);
+            const snapshotType* snapshot = current.load();
+            if (snapshot->find(id)){
+                return false;
+            }
+            auto next = new snapshotType(*snapshot);
+            next->insert(id, value);
+            publish(next);
+            return true;
+        }
+
+        /**
+         * @brief function to insert many values into the storage at once
+         * @details all values are added to one new snapshot, so the storage is only copied once
+         * @param values the ids and values to insert, for ids that already exist in the storage or appear more than once only the first value is kept
+         * @return the amount of inserted values
+         */
+        std::size_t insertBulk(std::span<const std::pair<identifierType, valueType>> values){
+            std::lock_guard lock(writeMutex);
+            auto next = new snapshotType(*current.load());
+            std::size_t ret = 0;
+            if constexpr (requires { next->insertBulk(values); }){
+                ret = next->insertBulk(values);
+            }else{
+                for (const auto& [id, value] : values){
+                    ret += next->insert(id, value) ? 1 : 0;
+                }
+            }
+            publish(next);
+            return ret;
+        }
+
+        /**
+         * @brief function to erase a value from the storage
+         * @param id the id of the value to erase
+         * @return true if the value was erased
+         * @return false if the id does not exist in the storage
+         */
+        bool erase(IdentifierView<identifierType> id){
+            std::lock_guard lock(writeMutex);
+            const snapshotType* snapshot = current.load();
+            if (!snapshot->find(id)){
+                return false;
+            }
+            auto next = new snapshotType(*snapshot);
+            next->erase(id);
+            publish(next);
+            return true;
+        }
+
+        /**
+         * @brief function to remove all values from the storage
+         */
+        void clear(){
+            std::lock_guard lock(writeMutex);
+            publish(new snapshotType());
+        }
+
+        /**
+         * @brief function to get the amount of values in the storage
+         * @return the amount of values in the storage
+         */
+        std::size_t size() const{
+            readerSlot& slot = enter();
+            std::size_t ret = current.load(std::memory_order_seq_cst)->size();
+            leave(slot);
+            return ret;
+        }
+
+        /**
+         * @brief function to call a function for every stored id and value of the current snapshot
+         * @param func the function to call, gets called as func(id, value)
+         */
+        template<class function>
+        void forEach(function&& func) const{
+            readerSlot& slot = enter();
+            current.load(std::memory_order_seq_cst)->forEach(func);
+            leave(slot);
+        }
+    private:
+        static constexpr std::uint64_t idleEpoch = std::numeric_limits<std::uint64_t>::max();
+
+        /**
+         * @brief owns the slot of the current thread and hands it back when the thread exits
+         */
+        struct threadSlotHolder{
+            threadSlotHolder() : slot(acquireSlot()) {}
+            ~threadSlotHolder(){
+                slot->inUse.store(false, std::memory_order_release);
+            }
+            readerSlot* slot;
+        };
+
+        static readerSlot* acquireSlot(){
+            // reuse a slot of a thread that has exited
+            for (readerSlot* slot = slotHead.load(std::memory_order_acquire); slot; slot = slot->next){
+                bool expected = false;
+                if (!slot->inUse.load(std::memory_order_relaxed) && slot->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)){
+                    return slot;
+                }
+            }
+            // slots are never freed, there is at most one per concurrently running thread
+            auto slot = new readerSlot();
+            slot->next = slotHead.load(std::memory_order_relaxed);
+            while (!slotHead.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)){
+            }
+            return slot;
+        }
+
+        static readerSlot& enter(){
+            thread_local threadSlotHolder holder;
+            readerSlot& slot = *holder.slot;
+            if (slot.depth++ == 0){
+                // the announcement has to be visible before the snapshot pointer is read, hence seq_cst on both
+                slot.epoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+            return slot;
+        }
+
+        static void leave(readerSlot& slot){
+            if (--slot.depth == 0){
+                slot.epoch.store(idleEpoch, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief publishes a new snapshot and deletes all retired snapshots no reader can see anymore, has to be called with writeMutex held
+         */
+        void publish(const snapshotType* next){
+            const snapshotType* old = current.exchange(next, std::memory_order_seq_cst);
+            retired.emplace_back(old, globalEpoch.fetch_add(1, std::memory_order_seq_cst));
+
+            std::uint64_t oldestReader = idleEpoch;
+            for (readerSlot* slot = slotHead.load(std::memory_order_acquire); slot; slot = slot->next){
+                oldestReader = std::min(oldestReader, slot->epoch.load(std::memory_order_seq_cst));
+            }
+            // a reader that announced epoch e can only hold snapshots retired at epoch e or later
+            auto end = std::remove_if(retired.begin(), retired.end(), [oldestReader](const auto& retiredSnapshot){
+                if (retiredSnapshot.second < oldestReader){
+                    delete retiredSnapshot.first;
+                    return true;
+                }
+                return false;
+            });
+            retired.erase(end, retired.end());
+        }
+
+        inline static std::atomic<std::uint64_t> globalEpoch{0};
+        inline static std::atomic<readerSlot*> slotHead{nullptr};
+
+        std::atomic<const snapshotType*> current{new snapshotType()};
+        std::mutex writeMutex;
+        std::vector<std::pair<const snapshotType*, std::uint64_t>> retired;
+    };
+
+    /**
+     * @brief callable wrapper for creator functions that stores the callable inline
+     *
+     * @details
+     * accepts function pointers and any copyable callable (for example capturing lambdas) that fits into capacity bytes, the callable is stored in a buffer inside the wrapper so there is never a heap allocation like with std::function,
+     * calling it is a single indirect call through a function pointer that was generated for the stored callable type
+     *
+     * callables that are trivially copyable (function pointers, lambdas capturing only pointers and numbers) are copied with a plain memory copy, everything else goes through a generated copy function
+     *
+     * @tparam signature the signature of the callable, functorReturn(argTypes...)
+     * @tparam capacity the size of the inline buffer in bytes
+     */
+    template<typename signature, std::size_t capacity = 4 * sizeof(void*)>
+    class InplaceCreator;
+
+    template<typename functorReturn, class... argTypes, std::size_t capacity>
+    class InplaceCreator<functorReturn(argTypes...), capacity>{
+    public:
+        InplaceCreator() = default;
+
+        /**
+         * @brief creates a wrapper that stores a copy of a callable
+         * @param callable the callable to store, has to be copyable, invocable as const with argTypes and fit into capacity bytes
+         */
+        template<class callableType, class = std::enable_if_t<!std::is_same_v<std::decay_t<callableType>, InplaceCreator>>>
+        InplaceCreator(callableType&& callable){ // NOLINT(google-explicit-constructor)
+            typedef std::decay_t<callableType> storedType;
+            static_assert(sizeof(storedType) <= capacity, "libFactory::InplaceCreator: the callable does not fit into the inline buffer, capture less or use a bigger capacity");
+            static_assert(alignof(storedType) <= alignof(std::max_align_t), "libFactory::InplaceCreator: the callable is over aligned");
+            static_assert(std::is_copy_constructible_v<storedType>, "libFactory::InplaceCreator: the callable has to be copyable");
+            new (buffer) storedType(std::forward<callableType>(callable));
+            invoker = &invokeStored<storedType>;
+            if constexpr (!std::is_trivially_copyable_v<storedType> || !std::is_trivially_destructible_v<storedType>){
+                manager = &manageStored<storedType>;
+            }
+        }
+
+        InplaceCreator(const InplaceCreator& other) : invoker(other.invoker), manager(other.manager) {
+            copyFrom(other);
+        }
+
+        InplaceCreator& operator=(const InplaceCreator& other){
+            if (this != &other){
+                reset();
+                invoker = other.invoker;
+                manager = other.manager;
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        ~InplaceCreator(){
+            reset();
+        }
+
+        /**
+         * @brief function to call the stored callable
+         * @param args the arguments that get forwarded to the callable
+         * @return the return value of the callable
+         */
+        functorReturn operator()(argTypes... args) const{
+            return invoker(buffer, std::forward<argTypes>(args)...);
+        }
+
+        /**
+         * @brief function to check if a callable is stored
+         */
+        explicit operator bool() const{
+            return invoker != nullptr;
+        }
+    private:
+        enum class operation{copy, destroy};
+
+        template<class storedType>
+        static functorReturn invokeStored(const void* storage, argTypes... args){
+            return (*static_cast<const storedType*>(storage))(std::forward<argTypes>(args)...);
+        }
+
+        template<class storedType>
+        static void manageStored(operation op, void* target, const void* source){
+            if (op == operation::copy){
+                new (target) storedType(*static_cast<const storedType*>(source));
+            }else{
+                static_cast<storedType*>(target)->~storedType();
+            }
+        }
+
+        void copyFrom(const InplaceCreator& other){
+            if (manager){
+                manager(operation::copy, buffer, other.buffer);
+            }else{
+                std::memcpy(buffer, other.buffer, capacity);
+            }
+        }
+
+        void reset(){
+            if (manager){
+                manager(operation::destroy, buffer, nullptr);
+            }
+            invoker = nullptr;
+            manager = nullptr;
+        }
+
+        functorReturn (*invoker)(const void*, argTypes...) = nullptr;
+        void (*manager)(operation, void*, const void*) = nullptr;
+        alignas(std::max_align_t) std::byte buffer[capacity] = {};
+    };
+
+    /**
+     * @brief gets the signature of a creator function type, functorReturn(argTypes...) for function pointers and libFactory::InplaceCreator, void for every other type
+     */
+    template<typename creatorFunctionType>
+    struct CreatorSignature{
+        typedef void type;
+    };
+
+    template<typename functorReturn, class... argTypes>
+    struct CreatorSignature<functorReturn (*)(argTypes...)>{
+        typedef functorReturn type(argTypes...);
+    };
+
+    template<typename signature, std::size_t capacity>
+    struct CreatorSignature<InplaceCreator<signature, capacity>>{
+        typedef signature type;
+    };
+
+    /**
+     * @brief gets the return type of a function signature
+     */
+    template<typename signature>
+    struct SignatureReturn{};
+
+    template<typename functorReturn, class... argTypes>
+    struct SignatureReturn<functorReturn(argTypes...)>{
+        typedef functorReturn type;
+    };
+
+    /**
+     * @brief deleter for objects that were not created with a plain new
+     *
+     * @details
+     * stores the function that destroys the object and gives its memory back to wherever it came from, so that factories can hand out objects from pools while the caller only sees one smart pointer type
+     * a default constructed deleter uses delete
+     *
+     * @tparam baseClass the base class of the deleted objects
+     */
+    template<class baseClass>
+    struct FactoryDeleter{
+        FactoryDeleter() = default;
+
+        /**
+         * @brief creates a deleter that uses a custom destroy function
+         * @param destroy the function that destroys the object and frees its memory, gets called as destroy(object, context)
+         * @param context pointer that gets passed on to destroy
+         */
+        FactoryDeleter(void (*destroy)(baseClass*, void*), void* context = nullptr) : destroy(destroy), context(context) {} // NOLINT(google-explicit-constructor)
+
+        /**
+         * @brief allows std::unique_ptr<baseClass> to be converted into libFactory::FactoryPtr
+         */
+        FactoryDeleter(const std::default_delete<baseClass>&) {} // NOLINT(google-explicit-constructor)
+
+        void operator()(baseClass* object) const{
+            if (destroy){
+                destroy(object, context);
+            }else{
+                delete object;
+            }
+        }
+
+        void (*destroy)(baseClass*, void*) = nullptr;
+        void* context = nullptr;
+    };
+
+    /**
+     * @brief smart pointer type for factories that hand out pooled objects, use this as the functorReturn of the factory
+     */
+    template<class baseClass>
+    using FactoryPtr = std::unique_ptr<baseClass, FactoryDeleter<baseClass>>;
+
+    /**
+     * @brief fixed size memory pool for one object type
+     *
+     * @details
+     * every thread keeps a cache of free blocks so that allocate() and deallocate() normally do not touch any shared state,
+     * when a cache runs empty it takes a batch of blocks from a mutex protected global free list (which allocates new chunks when it is empty), when a cache holds too many blocks it gives a batch back
+     * memory freed on another thread than it was allocated on simply ends up in the cache of the freeing thread
+     *
+     * the chunks are only released when the program exits
+     *
+     * @tparam object the object type the blocks are sized and aligned for
+     */
+    template<class object>
+    class ObjectPool{
+    public:
+        /**
+         * @brief function to get a block of memory for one object
+         * @return pointer to uninitialized memory of sizeof(object) bytes aligned to alignof(object)
+         */
+        static void* allocate(){
+            threadCache& cache = getThreadCache();
+            if (!cache.head){
+                getGlobalPool().take(cache);
+            }
+            node* block = cache.head;
+            cache.head = block->next;
+            cache.count--;
+            return block;
+        }
+
+        /**
+         * @brief function to give a block back to the pool
+         * @param memory the block to free, has to come from allocate()
+         */
+        static void deallocate(void* memory){
+            threadCache& cache = getThreadCache();
+            auto block = static_cast<node*>(memory);
+            block->next = cache.head;
+            cache.head = block;
+            if (++cache.count > 2 * batchSize){
+                getGlobalPool().give(cache, batchSize);
+            }
+        }
+
+        /**
+         * @brief function to construct an object in a pooled block
+         * @tparam baseClass the base class the returned pointer points to
+         * @param args the arguments that get forwarded to the constructor
+         * @return pointer to the new object with a deleter that returns the memory to the pool
+         */
+        template<class baseClass, class... argTypes>
+        static FactoryPtr<baseClass> make(argTypes&&... args){
+            void* memory = allocate();
+            object* ret;
+            try{
+                ret = new (memory) object(std::forward<argTypes>(args)...);
+            }catch (...){
+                deallocate(memory);
+                throw;
+            }
+            return FactoryPtr<baseClass>(ret, FactoryDeleter<baseClass>(&destroy<baseClass>));
+        }
+    private:
+        static constexpr std::size_t batchSize = 64;
+
+        union node{
+            node* next;
+            alignas(object) std::byte storage[sizeof(object)];
+        };
+
+        struct threadCache;
+
+        struct globalPool{
+            ~globalPool(){
+                for (node* chunk : chunks){
+                    delete[] chunk;
+                }
+            }
+
+            void take(threadCache& cache){
+                std::lock_guard lock(mutex);
+                if (!head){
+                    auto chunk = new node[batchSize];
+                    chunks.push_back(chunk);
+                    for (std::size_t i = 0; i < batchSize; i++){
+                        chunk[i].next = head;
+                        head = &chunk[i];
+                    }
+                    count += batchSize;
+                }
+                for (std::size_t i = 0; i < batchSize && head; i++){
+                    node* block = head;
+                    head = block->next;
+                    count--;
+                    block->next = cache.head;
+                    cache.head = block;
+                    cache.count++;
+                }
+            }
+
+            void give(threadCache& cache, std::size_t amount){
+                std::lock_guard lock(mutex);
+                for (std::size_t i = 0; i < amount && cache.head; i++){
+                    node* block = cache.head;
+                    cache.head = block->next;
+                    cache.count--;
+                    block->next = head;
+                    head = block;
+                    count++;
+                }
+            }
+
+            std::mutex mutex;
+            node* head = nullptr;
+            std::size_t count = 0;
+            std::vector<node*> chunks;
+        };
+
+        struct threadCache{
+            ~threadCache(){
+                getGlobalPool().give(*this, count);
+            }
+
+            node* head = nullptr;
+            std::size_t count = 0;
+        };
+
+        static globalPool& getGlobalPool(){
+            static globalPool pool;
+            return pool;
+        }
+
+        static threadCache& getThreadCache(){
+            thread_local threadCache cache;
+            return cache;
+        }
+
+        template<class baseClass>
+        static void destroy(baseClass* base, void*){
+            auto ret = static_cast<object*>(base);
+            ret->~object();
+            deallocate(ret);
+        }
+    };
+
+    /**
+     * @brief keeps released objects of one type on per thread freelists and hands them out again instead of constructing new ones
+     *
+     * @details
+     * the objects made by make() are not destroyed when their libFactory::FactoryPtr is, the deleter calls object::reset() and puts the object on the freelist of the thread that made it,
+     * make() takes an object from the freelist of its thread before it constructs a new one.
+     * an object that is released on another thread is pushed onto a lock free list of the thread that made it, which takes the whole list over the next time its freelist is empty.
+     * a freelist holds at most capacity objects, objects released into a full freelist are deleted.
+     * when a thread exits its free objects are deleted and its freelist is handed over to the next thread that starts making objects, so objects released after the thread that made them exited are still recycled
+     *
+     * @note the freelists are per object type, so ids registered with the same object type share them
+     * @warning reset() is called from the deleter and must not throw
+     * @tparam object the object type, has to be default constructible and implement reset() to put the object back into the state of a new object
+     */
+    template<class object>
+    class ObjectRecycler{
+    public:
+        /**
+         * @brief the most objects a freelist keeps
+         */
+        static constexpr std::size_t capacity = 64;
+
+        /**
+         * @brief function to get an object, from the freelist of the thread if it has one and newly constructed otherwise
+         * @tparam baseClass the base class the returned pointer points to
+         * @return pointer to the object with a deleter that recycles it
+         */
+        template<class baseClass>
+        static FactoryPtr<baseClass> make(){
+            freelist& list = getFreelist();
+            if (!list.head && list.remote.load(std::memory_order_relaxed)){
+                list.takeRemote();
+            }
+            node* block = list.head;
+            if (block){
+                list.head = block->next;
+                list.count--;
+            }else{
+                block = new node;
+            }
+            return FactoryPtr<baseClass>(block->get(), FactoryDeleter<baseClass>(&recycle<baseClass>, &list));
+        }
+
+        /**
+         * @brief function to get the amount of objects on the freelist of the current thread
+         * @note objects released on other threads are only counted once the freelist took them over
+         * @return the amount of free objects
+         */
+        static std::size_t getFreeCount(){
+            return getFreelist().count;
+        }
+    private:
+        struct node{
+            node(){
+                new (storage) object();
+            }
+
+            object* get(){
+                return std::launder(reinterpret_cast<object*>(storage));
+            }
+
+            alignas(object) std::byte storage[sizeof(object)];
+            node* next = nullptr;
+        };
+
+        static void destroyNode(node* block){
+            block->get()->~object();
+            delete block;
+        }
+
+        struct freelist{
+            void push(node* block){
+                if (count == capacity){
+                    destroyNode(block);
+                    return;
+                }
+                block->next = head;
+                head = block;
+                count++;
+            }
+
+            void pushRemote(node* block){
+                block->next = remote.load(std::memory_order_relaxed);
+                while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)){}
+            }
+
+            void takeRemote(){
+                // only the owning thread takes the list and it takes all of it, so there is no ABA problem
+                node* block = remote.exchange(nullptr, std::memory_order_acquire);
+                while (block){
+                    node* next = block->next;
+                    push(block);
+                    block = next;
+                }
+            }
+
+            void clear(){
+                takeRemote();
+                while (head){
+                    node* next = head->next;
+                    destroyNode(head);
+                    head = next;
+                }
+                count = 0;
+            }
+
+            node* head = nullptr;
+            std::size_t count = 0;
+            std::atomic<node*> remote{nullptr};
+        };
+
+        struct unownedFreelists{
+            ~unownedFreelists(){
+                for (freelist* list : lists){
+                    list->clear();
+                    delete list;
+                }
+            }
+
+            std::mutex mutex;
+            std::vector<freelist*> lists;
+        };
+
+        static unownedFreelists& getUnownedFreelists(){
+            static unownedFreelists unowned;
+            return unowned;
+        }
+
+        static freelist*& getCurrentFreelist(){
+            thread_local freelist* current = nullptr;
+            return current;
+        }
+
+        struct freelistOwner{
+            freelistOwner(){
+                auto& unowned = getUnownedFreelists();
+                std::lock_guard<std::mutex> lock(unowned.mutex);
+                if (unowned.lists.empty()){
+                    list = new freelist;
+                }else{
+                    list = unowned.lists.back();
+                    unowned.lists.pop_back();
+                }
+                getCurrentFreelist() = list;
+            }
+
+            ~freelistOwner(){
+                getCurrentFreelist() = nullptr;
+                list->clear();
+                auto& unowned = getUnownedFreelists();
+                std::lock_guard<std::mutex> lock(unowned.mutex);
+                unowned.lists.push_back(list);
+            }
+
+            freelist* list;
+        };
+
+        static freelist& getFreelist(){
+            thread_local freelistOwner owner;
+            return *owner.list;
+        }
+
+        template<class baseClass>
+        static void recycle(baseClass* base, void* context){
+            auto ret = static_cast<object*>(base);
+            ret->reset();
+            auto block = reinterpret_cast<node*>(ret);
+            auto owner = static_cast<freelist*>(context);
+            if (owner == getCurrentFreelist()){
+                owner->push(block);
+            }else{
+                owner->pushRemote(block);
+            }
+        }
+    };
+
+    /**
+     * @brief size, alignment and placement construction functions of a registered object type
+     *
+     * @details
+     * recorded by the registration helpers of the factories so the factory can construct objects into memory it did not get from new, for example a contiguous block in createBatch()
+     * the primary template is empty, only creator signatures that are function types (see libFactory::CreatorSignature) have a matching placement signature
+     *
+     * @tparam baseClass the base class of the objects
+     * @tparam signature the signature of the creator functions of the factory, functorReturn(argTypes...)
+     */
+    template<class baseClass, typename signature>
+    struct ObjectInfo{
+        /**
+         * @brief false if objects can not be placement constructed for this creator type
+         */
+        static constexpr bool supported = false;
+    };
+
+    template<class baseClass, typename functorReturn, class... argTypes>
+    struct ObjectInfo<baseClass, functorReturn(argTypes...)>{
+        /**
+         * @brief true if objects can be placement constructed for this creator type
+         */
+        static constexpr bool supported = true;
+
+        /**
+         * @brief sizeof() of the object type
+         */
+        std::size_t size;
+
+        /**
+         * @brief alignof() of the object type
+         */
+        std::size_t alignment;
+
+        /**
+         * @brief constructs the object into memory, takes the same arguments as the creator function
+         */
+        baseClass* (*construct)(void* memory, argTypes... args);
+
+        /**
+         * @brief calls the destructor of the object without freeing its memory
+         */
+        void (*destroy)(baseClass* object);
+
+        /**
+         * @brief function to get the object info of a type
+         * @tparam object the object type
+         * @return pointer to the static object info of the type
+         */
+        /**
+         * @brief true if the object type can be constructed from the creator function arguments
+         * @tparam object the object type
+         */
+        template<class object>
+        static constexpr bool constructible = std::is_constructible_v<object, argTypes...>;
+
+        template<class object>
+        static const ObjectInfo* of(){
+            static constexpr ObjectInfo info{sizeof(object), alignof(object), &constructAt<object>, &destroyAt<object>};
+            return &info;
+        }
+    private:
+        template<class object>
+        static baseClass* constructAt(void* memory, argTypes... args){
+            return new (memory) object(std::forward<argTypes>(args)...);
+        }
+
+        template<class object>
+        static void destroyAt(baseClass* base){
+            static_cast<object*>(base)->~object();
+        }
+    };
+
+    /**
+     * @brief a non owning pointer to an object that was constructed into memory provided by the caller, see libFactory::BasicFactory::createInto()
+     * @note the memory of the object is not freed by destroy, it still belongs to the caller
+     * @tparam baseClass the base class of the object
+     */
+    template<class baseClass>
+    struct PlacedObject{
+        /**
+         * @brief the object, nullptr if it could not be constructed
+         */
+        baseClass* object = nullptr;
+
+        /**
+         * @brief calls the destructor of the concrete object type, has to be called with object before its memory is reused
+         */
+        void (*destroy)(baseClass* object) = nullptr;
+
+        /**
+         * @brief check if the object was constructed
+         */
+        explicit operator bool() const{
+            return object != nullptr;
+        }
+    };
+
+    /**
+     * @brief a group of objects created in one call, owns all of the objects
+     *
+     * @details
+     * objects of types that were registered with a registration helper (so their size is known) are constructed next to each other in one contiguous memory block per id,
+     * objects that can only be created through their creator function are kept as functorReturn
+     *
+     * iterating the batch yields baseClass pointers in creation order, a pointer is nullptr if its id was not registered
+     *
+     * @tparam baseClass the base class of the objects
+     * @tparam functorReturn the return type of the creator functions
+     */
+    template<class baseClass, typename functorReturn>
+    class ObjectBatch{
+    public:
+        ObjectBatch() = default;
+        ObjectBatch(ObjectBatch&&) noexcept = default;
+        ObjectBatch& operator=(ObjectBatch&& other) noexcept{
+            if (this != &other){
+                release();
+                objects = std::move(other.objects);
+                blocks = std::move(other.blocks);
+                owned = std::move(other.owned);
+            }
+            return *this;
+        }
+        ObjectBatch(const ObjectBatch&) = delete;
+        ObjectBatch& operator=(const ObjectBatch&) = delete;
+
+        ~ObjectBatch(){
+            release();
+        }
+
+        /**
+         * @brief function to get the amount of objects in the batch
+         * @return the amount of objects, including nullptr entries
+         */
+        std::size_t size() const{
+            return objects.size();
+        }
+
+        bool empty() const{
+            return objects.empty();
+        }
+
+        baseClass* operator[](std::size_t index) const{
+            return objects[index];
+        }
+
+        typename std::vector<baseClass*>::const_iterator begin() const{
+            return objects.begin();
+        }
+
+        typename std::vector<baseClass*>::const_iterator end() const{
+            return objects.end();
+        }
+
+        /**
+         * @brief function to check if all objects of the batch live in contiguous blocks
+         * @return true if no object had to be created through its creator function
+         */
+        bool contiguous() const{
+            return owned.empty();
+        }
+
+        /**
+         * @brief function to construct count objects of one type into a new contiguous block and append them to the batch
+         * @note used by the factories to fill the batch
+         * @param info the info of the object type
+         * @param count the amount of objects to construct
+         * @param construct function that constructs one object, gets called as construct(memory, index) and returns the constructed object
+         */
+        template<class infoType, class constructFunction>
+        void appendBlock(const infoType& info, std::size_t count, constructFunction&& construct){
+            if (count == 0){
+                return;
+            }
+            objects.reserve(objects.size() + count);
+            // the block is registered first so that release() cleans up after a throwing constructor
+            blocks.push_back(block{static_cast<std::byte*>(::operator new(info.size * count, std::align_val_t(info.alignment))), info.alignment, info.destroy, {}});
+            block& current = blocks.back();
+            current.objects.reserve(count);
+            for (std::size_t i = 0; i < count; i++){
+                baseClass* ret = construct(current.memory + i * info.size, i);
+                current.objects.push_back(ret);
+                objects.push_back(ret);
+            }
+        }
+
+        /**
+         * @brief function to append an object that was created by a creator function
+         * @note used by the factories to fill the batch
+         * @param object the object, can be nullptr
+         */
+        void append(functorReturn object){
+            objects.push_back(object ? &*object : nullptr);
+            if (object){
+                owned.push_back(std::move(object));
+            }
+        }
+
+        /**
+         * @brief function to append a nullptr entry for an id that does not exist
+         * @note used by the factories to fill the batch
+         */
+        void appendMissing(){
+            objects.push_back(nullptr);
+        }
+
+        /**
+         * @brief function to put the objects into a different order
+         * @note used by the factories to fill the batch
+         * @param positions the new position of every object
+         */
+        void reorder(const std::vector<std::size_t>& positions){
+            std::vector<baseClass*> ordered(objects.size());
+            for (std::size_t i = 0; i < positions.size(); i++){
+                ordered[positions[i]] = objects[i];
+            }
+            objects = std::move(ordered);
+        }
+    private:
+        struct block{
+            std::byte* memory;
+            std::size_t alignment;
+            void (*destroy)(baseClass*);
+            std::vector<baseClass*> objects;
+        };
+
+        void release(){
+            for (auto& current : blocks){
+                for (std::size_t i = current.objects.size(); i > 0; i--){
+                    current.destroy(current.objects[i - 1]);
+                }
+                ::operator delete(current.memory, std::align_val_t(current.alignment));
+            }
+            blocks.clear();
+            owned.clear();
+            objects.clear();
+        }
+
+        std::vector<baseClass*> objects;
+        std::vector<block> blocks;
+        std::vector<functorReturn> owned;
+    };
+
+    /**
+     * @brief a lazily evaluated sequence of created objects, returned by the createStream() functions of the factories
+     *
+     * @details
+     * the stream is a coroutine that creates the next object when the iterator is dereferenced or compared to end() after it was incremented, so only the objects the consumer currently holds are alive instead of a container of all of them,
+     * and adaptors like std::views::take() that stop without looking at the next element never create it.
+     * it is a single pass std::ranges::input_range and a std::ranges::view, so it composes with the std::views adaptors, dereferencing the iterator yields the object as functorReturn&& to move out of the stream.
+     * exceptions of the creator functions are rethrown where the object would have been created, after that the stream is at its end
+     *
+     * @note begin() can only be called once
+     * @tparam functorReturn the return type of the creator functions
+     */
+    template<typename functorReturn>
+    class ObjectStream: public std::ranges::view_interface<ObjectStream<functorReturn>>{
+    public:
+        /**
+         * @brief the coroutine promise, created by the compiler
+         */
+        class promise_type{
+        public:
+            ObjectStream get_return_object(){
+                return ObjectStream(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept{
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept{
+                return {};
+            }
+
+            std::suspend_always yield_value(functorReturn&& object) noexcept{
+                // the yielded temporary lives until the coroutine is resumed
+                current = std::addressof(object);
+                return {};
+            }
+
+            void return_void() noexcept{}
+
+            void unhandled_exception(){
+                exception = std::current_exception();
+            }
+        private:
+            friend class ObjectStream;
+
+            functorReturn* current = nullptr;
+            std::exception_ptr exception;
+            // the coroutine has not been resumed to the next object yet
+            bool pending = true;
+        };
+
+        /**
+         * @brief the input iterator of the stream
+         */
+        class iterator{
+        public:
+            typedef functorReturn value_type;
+            typedef std::ptrdiff_t difference_type;
+
+            iterator() = default;
+
+            functorReturn&& operator*() const{
+                ObjectStream::advance(handle);
+                return std::move(*handle.promise().current);
+            }
+
+            iterator& operator++(){
+                // skips the current object, creating it first if it was not looked at
+                ObjectStream::advance(handle);
+                handle.promise().pending = true;
+                return *this;
+            }
+
+            void operator++(int){
+                ++*this;
+            }
+
+            friend bool operator==(const iterator& it, std::default_sentinel_t){
+                return it.atEnd();
+            }
+        private:
+            friend class ObjectStream;
+
+            bool atEnd() const{
+                if (!handle){
+                    return true;
+                }
+                ObjectStream::advance(handle);
+                return handle.done();
+            }
+
+            explicit iterator(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        /**
+         * @brief constructs an empty stream
+         */
+        ObjectStream() = default;
+
+        ObjectStream(ObjectStream&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        ObjectStream& operator=(ObjectStream&& other) noexcept{
+            if (this != &other){
+                if (handle){
+                    handle.destroy();
+                }
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~ObjectStream(){
+            if (handle){
+                handle.destroy();
+            }
+        }
+
+        /**
+         * @return iterator to the first object
+         */
+        iterator begin(){
+            return iterator(handle);
+        }
+
+        /**
+         * @return the end of the stream
+         */
+        std::default_sentinel_t end() const noexcept{
+            return {};
+        }
+    private:
+        explicit ObjectStream(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+        static void advance(std::coroutine_handle<promise_type> handle){
+            if (!handle.promise().pending || handle.done()){
+                return;
+            }
+            handle.promise().pending = false;
+            handle.resume();
+            if (handle.promise().exception) [[unlikely]]{
+                std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    /**
+     * @brief the default instrumentation policy of the factories, records nothing
+     *
+     * @details
+     * an instrumentation policy gets told about every create() call, it has to provide a static constexpr bool enabled, a hit(id) function returning a scope object that lives while the creator function runs and a miss(id) function,
+     * all functions of this policy are empty so a factory using it compiles to the same code as a factory without instrumentation
+     *
+     * @tparam identifierType the type of the identifier
+     * @see libFactory::CreationMetrics
+     */
+    template<class identifierType>
+    class NoInstrumentation{
+    public:
+        /**
+         * @brief false, nothing is recorded
+         */
+        static constexpr bool enabled = false;
+
+        /**
+         * @brief the scope of a creator function call
+         */
+        struct hitScope{};
+
+        /**
+         * @brief called when create() found the id, before the creator function is called
+         * @return an empty scope
+         */
+        hitScope hit(IdentifierView<identifierType>){
+            return {};
+        }
+
+        /**
+         * @brief called when create() did not find the id
+         */
+        void miss(IdentifierView<identifierType>){}
+    };
+
+    /**
+     * @brief instrumentation policy that records per id hit and miss counts and a latency histogram of the creator functions
+     *
+     * @details
+     * every thread counts into its own table so the hot path does not touch any shared cache lines, the counters are only written by the thread that owns the table with relaxed loads and stores,
+     * snapshot() sums up the tables of all threads. the table of a thread that exits is handed over to the next thread that uses the factory so no counts are lost
+     *
+     * latency[i] of the histogram counts the creator calls that took [2^i, 2^(i+1)) nanoseconds, latency[0] also counts the calls that took less than 1 nanosecond
+     *
+     * @note only create() is instrumented, createBatch() is not. every missed id gets its own counters, so a stream of random unknown ids grows the tables
+     * @tparam identifierType the type of the identifier, has to be hashable with libFactory::IdentifierTraits
+     * @see GoogleTests/instrumentationTests.cpp
+     */
+    template<class identifierType>
+    class CreationMetrics{
+        struct idCounters;
+    public:
+        /**
+         * @brief true, the factory records its create() calls
+         */
+        static constexpr bool enabled = true;
+
+        /**
+         * @brief the amount of buckets of the latency histogram
+         */
+        static constexpr std::size_t histogramBuckets = 32;
+
+        /**
+         * @brief the recorded metrics of one id
+         */
+        struct idMetrics{
+            /**
+             * @brief the id
+             */
+            identifierType id;
+
+            /**
+             * @brief the amount of create() calls that found the id
+             */
+            std::uint64_t hits = 0;
+
+            /**
+             * @brief the amount of create() calls that did not find the id
+             */
+            std::uint64_t misses = 0;
+
+            /**
+             * @brief the latency histogram of the creator function, see the class details for the bucket ranges
+             */
+            std::array<std::uint64_t, histogramBuckets> latency{};
+        };
+
+        /**
+         * @brief measures the time of one creator function call and records it when it goes out of scope
+         */
+        class hitScope{
+        public:
+            /**
+             * @brief starts measuring
+             * @param counters the counters of the id
+             */
+            explicit hitScope(idCounters& counters) : counters(counters), start(std::chrono::steady_clock::now()) {}
+
+            hitScope(const hitScope&) = delete;
+            hitScope& operator=(const hitScope&) = delete;
+
+            ~hitScope(){
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                std::size_t bucket = elapsed > 0 ? static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(elapsed))) - 1 : 0;
+                increment(counters.latency[std::min(bucket, histogramBuckets - 1)]);
+            }
+        private:
+            idCounters& counters;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        CreationMetrics() = default;
+        CreationMetrics(const CreationMetrics&) = delete;
+        CreationMetrics& operator=(const CreationMetrics&) = delete;
+
+        /**
+         * @brief called when create() found the id, before the creator function is called
+         * @param id the id
+         * @return a scope that records the latency of the creator function when it is destroyed
+         */
+        hitScope hit(IdentifierView<identifierType> id){
+            idCounters& counters = getCounters(id);
+            increment(counters.hits);
+            return hitScope(counters);
+        }
+
+        /**
+         * @brief called when create() did not find the id
+         * @param id the id
+         */
+        void miss(IdentifierView<identifierType> id){
+            increment(getCounters(id).misses);
+        }
+
+        /**
+         * @brief function to get the metrics recorded so far summed up over all threads
+         * @note the counts of threads that are creating objects while this runs may or may not be included
+         * @return the metrics of every id that was passed to create(), in no particular order
+         */
+        std::vector<idMetrics> snapshot() const{
+            std::vector<idMetrics> ret;
+            HashStorage<identifierType, std::size_t> positions;
+            std::lock_guard<std::mutex> lock(tablesMutex);
+            for (const auto& table : tables){
+                std::lock_guard<std::mutex> tableLock(table->insertMutex);
+                table->ids.forEach([&ret, &positions](const identifierType& id, const std::shared_ptr<idCounters>& counters){
+                    const std::size_t* position = positions.find(id);
+                    if (!position){
+                        positions.insert(id, ret.size());
+                        ret.push_back(idMetrics{id});
+                    }
+                    idMetrics& metrics = ret[position ? *position : ret.size() - 1];
+                    metrics.hits += counters->hits.load(std::memory_order_relaxed);
+                    metrics.misses += counters->misses.load(std::memory_order_relaxed);
+                    for (std::size_t i = 0; i < histogramBuckets; i++){
+                        metrics.latency[i] += counters->latency[i].load(std::memory_order_relaxed);
+                    }
+                });
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to write a human readable summary of snapshot() to a stream, one line per id
+         * @note identifierType has to be printable with operator<<
+         * @param out the stream to write to
+         */
+        void dump(std::ostream& out) const{
+            for (const auto& metrics : snapshot()){
+                out << metrics.id << ": hits=" << metrics.hits << " misses=" << metrics.misses << " latency(ns)={";
+                const char* separator = "";
+                for (std::size_t i = 0; i < histogramBuckets; i++){
+                    if (metrics.latency[i]){
+                        out << separator << "<" << (std::uint64_t(1) << (i + 1)) << ":" << metrics.latency[i];
+                        separator = ", ";
+                    }
+                }
+                out << "}\n";
+            }
+        }
+    private:
+        struct idCounters{
+            std::atomic<std::uint64_t> hits{0};
+            std::atomic<std::uint64_t> misses{0};
+            std::array<std::atomic<std::uint64_t>, histogramBuckets> latency{};
+        };
+
+        struct threadTable{
+            std::atomic<bool> inUse{true};
+            mutable std::mutex insertMutex;
+            HashStorage<identifierType, std::shared_ptr<idCounters>> ids;
+        };
+
+        struct threadTables{
+            std::vector<std::shared_ptr<threadTable>> tables;
+
+            ~threadTables(){
+                for (auto& table : tables){
+                    if (table){
+                        table->inUse.store(false, std::memory_order_release);
+                    }
+                }
+            }
+        };
+
+        // only the owning thread writes a counter, so a plain load and store is enough and avoids a locked read modify write
+        static void increment(std::atomic<std::uint64_t>& counter){
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        idCounters& getCounters(IdentifierView<identifierType> id){
+            threadTable& table = getThreadTable();
+            if (const auto* counters = table.ids.find(id)){
+                return **counters;
+            }
+            auto counters = std::make_shared<idCounters>();
+            std::lock_guard<std::mutex> lock(table.insertMutex);
+            table.ids.insert(id, counters);
+            return *counters;
+        }
+
+        threadTable& getThreadTable(){
+            thread_local threadTables local;
+            if (index < local.tables.size() && local.tables[index]){
+                return *local.tables[index];
+            }
+            if (index >= local.tables.size()){
+                local.tables.resize(index + 1);
+            }
+            std::lock_guard<std::mutex> lock(tablesMutex);
+            for (const auto& table : tables){
+                bool expected = false;
+                if (table->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)){
+                    local.tables[index] = table;
+                    return *table;
+                }
+            }
+            tables.push_back(std::make_shared<threadTable>());
+            local.tables[index] = tables.back();
+            return *tables.back();
+        }
+
+        inline static std::atomic<std::size_t> nextIndex{0};
+
+        const std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        mutable std::mutex tablesMutex;
+        std::vector<std::shared_ptr<threadTable>> tables;
+    };
+
+    /**
+     * @brief a creator function resolved from a factory, calling it skips the registry lookup of create()
+     *
+     * @details
+     * the handle holds a copy of the creator function and the registry generation it was resolved at,
+     * every removeCreatorFunc() that removes an id and every clearRegistry() of the factory starts a new generation and invalidates all handles resolved before it, even the ones of other ids.
+     * calling an invalid handle returns nullptr like create() does for an unknown id, resolve the id again to get a valid handle.
+     * registering new ids and sealing the registry do not invalidate handles
+     *
+     * @note calls through a handle are not reported to the instrumentation policy of the factory
+     * @warning a call that runs at the same time as removeCreatorFunc() or clearRegistry() on another thread may still call the old creator function
+     * @tparam creatorFunctionType the creator function type of the factory
+     * @see libFactory::FactoryBase::resolve()
+     */
+    template<typename creatorFunctionType>
+    class CreatorHandle{
+    public:
+        /**
+         * @brief constructs an invalid handle
+         */
+        CreatorHandle() = default;
+
+        /**
+         * @brief constructs a handle, used by libFactory::FactoryBase::resolve()
+         * @param creator the creator function
+         * @param generation the generation counter of the factory
+         * @param resolvedGeneration the value of the generation counter before the creator function was looked up
+         */
+        CreatorHandle(const creatorFunctionType& creator, const std::atomic<std::uint64_t>* generation, std::uint64_t resolvedGeneration) : creator(creator), generation(generation), resolvedGeneration(resolvedGeneration) {}
+
+        /**
+         * @brief function to check if the handle still calls the registered creator function
+         * @return true if the handle is valid
+         * @return false if the handle was default constructed or the id was not found or the registry was modified after resolving
+         */
+        bool valid() const{
+            return generation && generation->load(std::memory_order_acquire) == resolvedGeneration;
+        }
+
+        /**
+         * @brief see valid()
+         */
+        explicit operator bool() const{
+            return valid();
+        }
+
+        /**
+         * @brief calls the creator function
+         * @param args the arguments passed to the creator function, the same ones create() takes after the id
+         * @return the return value of the creator function
+         * @return nullptr if the handle is not valid
+         */
+        template<class... callArgs>
+        auto operator()(callArgs&&... args) const{
+            using returnType = decltype(creator(std::forward<callArgs>(args)...));
+            if (!valid()){
+                return returnType(nullptr);
+            }
+            return creator(std::forward<callArgs>(args)...);
+        }
+    private:
+        creatorFunctionType creator{};
+        const std::atomic<std::uint64_t>* generation = nullptr;
+        std::uint64_t resolvedGeneration = 0;
+    };
+
+    template<class factory, class object>
+    class autoRegister;
+
+    template<class factory, class object>
+    class staticRegister;
+
     /**
      * @brief the base class of all factories
      *
      * @details
-     * the base class of all factories, if you create your own factory class then you need to inherit this either directly or indirectly
-     * this class does not have a function to create objects, you either need to use one of the predefined factory types (see libFactory::BasicFactory) or create your own factory and implement a create function
+     * the base class of all factories, if you create your own factory class then you need to inherit this either directly or indirectly
+     * this class does not have a function to create objects, you either need to use one of the predefined factory types (see libFactory::BasicFactory) or create your own factory and implement a create function
+     * the static functions work on the default registry instance (see getDefaultInstance()), more isolated registries can be made with libFactory::FactoryBase::factoryInstance
+     *
+     * @tparam baseClass the base class of all the constructed objects
+     * @tparam creatorFunctionType the type definition of the creator functions that get registered
+     * @tparam identifierType the type of the identifier used to identify what object to create, uses baseClass::__factoryIdentifierType__ if not defined, ids are passed to all functions as libFactory::IdentifierView so string ids can be looked up from a std::string_view or string literal without allocating
+     * @tparam registryStorage the storage policy used for the registry (see libFactory::MapStorage, libFactory::FlatStorage, libFactory::HashStorage and libFactory::DenseStorage), uses libFactory::AutoStorage if not defined
+     * @tparam instrumentation the instrumentation policy that create() reports to (see libFactory::CreationMetrics), uses libFactory::NoInstrumentation if not defined
+     */
+    template<class baseClass, typename creatorFunctionType, class identifierType = typename baseClass::__factoryIdentifierType__, template<class, class> class registryStorage = AutoStorage, template<class> class instrumentation = NoInstrumentation>
+    class FactoryBase{
+        template<class factory, class object>
+        friend class autoRegister;
+        template<class factory, class object>
+        friend class staticRegister;
+    public:
+        /**
+         * @brief the identifier type typedef
+         */
+        typedef identifierType factoryIdentifierType;
+
+        /**
+         * @brief the instrumentation policy typedef
+         */
+        typedef instrumentation<identifierType> instrumentationType;
+
+        /**
+         * @brief the creator function typedef
+         */
+        typedef creatorFunctionType factoryCreatorFunctionType;
+
+        /**
+         * @brief how a libFactory::FactoryBase::factoryInstance keeps its registry for lookups
+         */
+        enum class replicationMode{
+            /**
+             * @brief all threads look ids up in the one registry of the instance
+             */
+            none,
+            /**
+             * @brief every thread looks ids up in its own copy of the registry, see libFactory::FactoryBase::factoryInstance
+             */
+            perThread
+        };
+
+        class factoryInstance;
+
+        /**
+         * @brief function to get the instance the static functions of the factory work on
+         * @details the objects registered with autoRegister and staticRegister are in this instance
+         * @return reference to the default instance
+         */
+        static factoryInstance& getDefaultInstance(){
+            static factoryInstance defaultInstance(replicationMode::none, true);
+            if (pendingRegistrations.load(std::memory_order_acquire)) [[unlikely]]{
+                addPendingRegistrations(defaultInstance);
+            }
+            return defaultInstance;
+        }
+
+        /**
+         * @brief function to get the instrumentation of the factory, for example to call libFactory::CreationMetrics::snapshot()
+         * @return reference to the instrumentation
+         */
+        static instrumentationType& getInstrumentation(){
+            static instrumentationType factoryInstrumentation;
+            return factoryInstrumentation;
+        }
+
+        /**
+         * @brief function to register a creator function to create an object
+         * @param id the id used to identify the object
+         * @param funcCreate the function used to create the object
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry or the registry is sealed
+         */
+        static bool registerCreatorFunc(IdentifierView<identifierType> id, const creatorFunctionType& funcCreate){
+            return getDefaultInstance().registerCreatorFunc(id, funcCreate);
+        }
+
+        /**
+         * @brief function to remove a creator function from the registry
+         * @param id id of the function to remove
+         * @return true if the function was removed
+         * @return false if the id does not exist in the registry or the registry is sealed
+         */
+        static bool removeCreatorFunc(IdentifierView<identifierType> id){
+            return getDefaultInstance().removeCreatorFunc(id);
+        }
+
+        /**
+         * @brief function to clear the registry
+         * @note this also unseals the registry
+         */
+        static void clearRegistry(){
+            getDefaultInstance().clearRegistry();
+        }
+
+        /**
+         * @brief a registration that failed because its id is equal to a registered id with a different name, see libFactory::IdentifierTraits<FactoryId>::collides()
+         */
+        struct collision{
+            /**
+             * @brief the id in the registry
+             */
+            identifierType registered;
+
+            /**
+             * @brief the id whose registration failed
+             */
+            identifierType rejected;
+        };
+
+        /**
+         * @brief function to get the registrations that failed because of an id collision, see libFactory::FactoryId
+         * @note only identifier types whose libFactory::IdentifierTraits implement collides() can collide, for all other types this is always empty
+         * @return the collisions in the order they happened since the registry was last cleared
+         */
+        static std::vector<collision> getCollisions(){
+            return getDefaultInstance().getCollisions();
+        }
+
+        /**
+         * @brief the creator handle typedef, see libFactory::CreatorHandle
+         */
+        typedef CreatorHandle<creatorFunctionType> creatorHandleType;
+
+        /**
+         * @brief function to look up the creator function of an id once and get a handle that calls it directly
+         * @note the handle is invalidated by removeCreatorFunc() and clearRegistry(), see libFactory::CreatorHandle
+         * @param id the id to resolve
+         * @return a handle to the creator function
+         * @return an invalid handle if the id does not exist in the registry
+         */
+        static creatorHandleType resolve(IdentifierView<identifierType> id){
+            return getDefaultInstance().resolve(id);
+        }
+
+        /**
+         * @brief function to seal the registry
+         *
+         * @details
+         * compiles the current contents of the registry into an immutable perfect hash index (see libFactory::SealedRegistry) that is used for all lookups from then on,
+         * after sealing registerCreatorFunc() and removeCreatorFunc() always fail, call this once all objects are registered, for example at the start of main() after the autoRegister static init
+         *
+         * @warning sealing is not thread safe, no other thread may use the factory while it is being sealed
+         * @return true if the registry was sealed
+         * @return false if the registry is already sealed or the ids could not be indexed (two ids with the same std::hash value)
+         */
+        static bool seal(){
+            return getDefaultInstance().seal();
+        }
+
+        /**
+         * @brief function to check if the registry is sealed
+         * @return true if the registry is sealed
+         * @return false if the registry can still be modified
+         */
+        static bool isSealed(){
+            return getDefaultInstance().isSealed();
+        }
+
+        /**
+         * @brief function to set how the registry is kept for lookups, see libFactory::FactoryBase::factoryInstance::setReplication()
+         * @warning not thread safe, call it before the factory is used from multiple threads
+         * @param replication the replication mode
+         */
+        static void setReplication(replicationMode replication){
+            getDefaultInstance().setReplication(replication);
+        }
+
+        /**
+         * @brief function to get the largest sizeof() of the registered object types, used to size the buffers passed to createInto()
+         * @note only object types registered with a registration helper (or autoRegister) are known, the registry is walked on every call
+         * @return the largest object size
+         * @return 0 if no object type is known
+         */
+        static std::size_t maxObjectSize(){
+            return getDefaultInstance().maxObjectSize();
+        }
+
+        /**
+         * @brief function to get the largest alignof() of the registered object types, used to align the buffers passed to createInto()
+         * @note only object types registered with a registration helper (or autoRegister) are known, the registry is walked on every call
+         * @return the largest object alignment
+         * @return 0 if no object type is known
+         */
+        static std::size_t maxObjectAlignment(){
+            return getDefaultInstance().maxObjectAlignment();
+        }
+    protected:
+        /**
+         * @brief the object info typedef, see libFactory::ObjectInfo
+         */
+        typedef ObjectInfo<baseClass, typename CreatorSignature<creatorFunctionType>::type> objectInfoType;
+
+        /**
+         * @brief a registered creator function together with the info of the object type it creates
+         */
+        struct registryEntry{
+            /**
+             * @brief the creator function
+             */
+            creatorFunctionType creator;
+
+            /**
+             * @brief the info of the created object type, nullptr if the type is unknown (the creator function was registered with registerCreatorFunc())
+             */
+            const objectInfoType* info;
+        };
+
+        /**
+         * @brief the registry map typedef
+         */
+        typedef registryStorage<identifierType, registryEntry> registryMapType;
+
+        /**
+         * @brief the sealed registry typedef
+         */
+        typedef SealedRegistry<identifierType, registryEntry> sealedRegistryType;
+
+        /**
+         * @brief the type returned by the registry storage find() function, a pointer to the registry entry or a pointer like guard (see libFactory::ConcurrentStorage)
+         */
+        typedef decltype(std::declval<const registryMapType&>().find(std::declval<IdentifierView<identifierType>>())) entryLookupType;
+    public:
+        /**
+         * @brief a factory registry as an object, for registries that are isolated from each other (one per tenant, per plugin, per test, ...)
+         *
+         * @details
+         * every instance has its own registry, sealed index, creator handle generation and instrumentation and offers the registry functions of the static factory API plus create() and createInto() for the objects registered in it.
+         * the static functions of the factory work on the default instance (see getDefaultInstance()), so the static API is a thin wrapper around one instance per factory type
+         *
+         * with replicationMode::perThread every thread that looks ids up gets its own copy of the registry, made by that thread (so with first touch memory placement it lives on the NUMA node of the thread),
+         * lookups then only read thread local memory and one shared counter that changes only when the registry is modified, so threads on different cores never share written cache lines.
+         * modifying the registry bumps the counter and every thread copies the registry again on its next lookup, so replication is for registries that are read a lot more often than they are modified.
+         * in this mode the registry functions are also safe to call while other threads create objects
+         *
+         * @note a thread keeps its copy until it exits or it looks ids up in another instance that got the same slot, so replicating many short lived instances costs memory
+         * @warning the instance has to outlive the creator handles resolved from it and the creations running on it
+         * @see GoogleTests/factoryInstanceTests.cpp
+         */
+        class factoryInstance{
+            friend class FactoryBase;
+        public:
+            /**
+             * @brief constructs an instance with an empty registry
+             * @param mode how the registry is kept for lookups, see setReplication()
+             */
+            explicit factoryInstance(replicationMode mode = replicationMode::none) : factoryInstance(mode, false) {}
+
+            factoryInstance(const factoryInstance&) = delete;
+            factoryInstance& operator=(const factoryInstance&) = delete;
+
+            ~factoryInstance(){
+                if (!isDefault){
+                    std::lock_guard<std::mutex> lock(slotMutex);
+                    freeSlots.push_back(slot);
+                }
+            }
+
+            /**
+             * @brief function to get the instrumentation of the instance, the default instance reports to the instrumentation of the static factory
+             * @return reference to the instrumentation
+             */
+            instrumentationType& getInstrumentation(){
+                return isDefault ? FactoryBase::getInstrumentation() : ownInstrumentation;
+            }
+
+            /**
+             * @brief function to register a creator function to create an object
+             * @param id the id used to identify the object
+             * @param funcCreate the function used to create the object
+             * @return true if the function was registered
+             * @return false if the id already exists in the registry or the registry is sealed
+             */
+            bool registerCreatorFunc(IdentifierView<identifierType> id, const creatorFunctionType& funcCreate){
+                return registerEntry(id, registryEntry{funcCreate, nullptr});
+            }
+
+            /**
+             * @brief function to remove a creator function from the registry
+             * @param id id of the function to remove
+             * @return true if the function was removed
+             * @return false if the id does not exist in the registry or the registry is sealed
+             */
+            bool removeCreatorFunc(IdentifierView<identifierType> id){
+                std::lock_guard<std::mutex> lock(writeMutex);
+                if (sealedRegistry || !registry.erase(id)){
+                    return false;
+                }
+                generation.fetch_add(1, std::memory_order_release);
+                version.fetch_add(1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * @brief function to clear the registry
+             * @note this also unseals the registry
+             */
+            void clearRegistry(){
+                std::lock_guard<std::mutex> lock(writeMutex);
+                registry.clear();
+                collisions.clear();
+                sealedRegistry.reset();
+                generation.fetch_add(1, std::memory_order_release);
+                version.fetch_add(1, std::memory_order_release);
+            }
+
+            /**
+             * @brief function to get the registrations that failed because of an id collision, see libFactory::FactoryBase::getCollisions()
+             * @return the collisions since the registry was last cleared
+             */
+            std::vector<collision> getCollisions() const{
+                std::lock_guard<std::mutex> lock(writeMutex);
+                return collisions;
+            }
+
+            /**
+             * @brief function to look up the creator function of an id once and get a handle that calls it directly
+             * @note the handle is invalidated by removeCreatorFunc() and clearRegistry(), see libFactory::CreatorHandle
+             * @param id the id to resolve
+             * @return a handle to the creator function
+             * @return an invalid handle if the id does not exist in the registry
+             */
+            creatorHandleType resolve(IdentifierView<identifierType> id){
+                // read the generation first so a removal that races with the lookup invalidates the handle
+                std::uint64_t resolvedGeneration = generation.load(std::memory_order_acquire);
+                if (auto entry = findEntry(id)){
+                    return creatorHandleType(entry->creator, &generation, resolvedGeneration);
+                }
+                return creatorHandleType();
+            }
+
+            /**
+             * @brief function to seal the registry, see libFactory::FactoryBase::seal()
+             * @warning sealing is not thread safe, no other thread may use the instance while it is being sealed
+             * @return true if the registry was sealed
+             * @return false if the registry is already sealed or the ids could not be indexed (two ids with the same std::hash value)
+             */
+            bool seal(){
+                std::lock_guard<std::mutex> lock(writeMutex);
+                if (sealedRegistry){
+                    return false;
+                }
+                sealedRegistryType index;
+                if (!index.build(registry)){
+                    return false;
+                }
+                sealedRegistry.emplace(std::move(index));
+                return true;
+            }
+
+            /**
+             * @brief function to check if the registry is sealed
+             * @return true if the registry is sealed
+             * @return false if the registry can still be modified
+             */
+            bool isSealed() const{
+                return sealedRegistry.has_value();
+            }
+
+            /**
+             * @brief function to set how the registry is kept for lookups
+             * @note a sealed registry is always looked up in its shared immutable index
+             * @warning not thread safe, call it before the instance is used from multiple threads
+             * @param mode the replication mode
+             */
+            void setReplication(replicationMode mode){
+                replication = mode;
+            }
+
+            /**
+             * @brief function to get the largest sizeof() of the registered object types, see libFactory::FactoryBase::maxObjectSize()
+             * @return the largest object size
+             * @return 0 if no object type is known
+             */
+            std::size_t maxObjectSize(){
+                return maxObjectInfo(&objectInfoSize);
+            }
+
+            /**
+             * @brief function to get the largest alignof() of the registered object types, see libFactory::FactoryBase::maxObjectAlignment()
+             * @return the largest object alignment
+             * @return 0 if no object type is known
+             */
+            std::size_t maxObjectAlignment(){
+                return maxObjectInfo(&objectInfoAlignment);
+            }
+
+            /**
+             * @brief function to create a object from its id
+             * @param id the id of the object
+             * @param args the arguments passed to the creator function
+             * @return the return value of the creator function
+             * @return nullptr if the id is not registered
+             */
+            template<class... argTypes>
+            auto create(IdentifierView<identifierType> id, argTypes&&... args){
+                using returnType = decltype(std::declval<const creatorFunctionType&>()(std::forward<argTypes>(args)...));
+                if (auto entry = findEntry(id)){
+                    [[maybe_unused]] auto scope = getInstrumentation().hit(id);
+                    return entry->creator(std::forward<argTypes>(args)...);
+                }
+                getInstrumentation().miss(id);
+                return returnType(nullptr);
+            }
+
+            /**
+             * @brief function to construct a object into a buffer instead of allocating it, see the createInto() functions of the factories
+             * @param id the id of the object
+             * @param buffer the buffer to construct the object in
+             * @param size the size of the buffer in bytes
+             * @param args the arguments passed to the constructor
+             * @return the constructed object
+             * @return an empty libFactory::PlacedObject if the id is not registered, its object type is unknown or it does not fit into the buffer
+             */
+            template<class... argTypes>
+            PlacedObject<baseClass> createInto(IdentifierView<identifierType> id, void* buffer, std::size_t size, argTypes&&... args){
+                if (auto entry = findEntry(id)){
+                    [[maybe_unused]] auto scope = getInstrumentation().hit(id);
+                    return constructInto(*entry, buffer, size, std::forward<argTypes>(args)...);
+                }
+                getInstrumentation().miss(id);
+                return {};
+            }
+        private:
+            factoryInstance(replicationMode mode, bool isDefault) : replication(mode), isDefault(isDefault) {}
+
+            bool registerEntry(IdentifierView<identifierType> id, const registryEntry& entry){
+                std::lock_guard<std::mutex> lock(writeMutex);
+                if (sealedRegistry){
+                    return false;
+                }
+                if (!registry.insert(id, entry)){
+                    recordCollision(id);
+                    return false;
+                }
+                version.fetch_add(1, std::memory_order_release);
+                return true;
+            }
+
+            template<class object>
+            bool registerObjectEntry(IdentifierView<identifierType> id, const creatorFunctionType& funcCreate){
+                if constexpr (objectInfoType::supported){
+                    return registerEntry(id, registryEntry{funcCreate, objectInfoType::template of<object>()});
+                }else{
+                    return registerEntry(id, registryEntry{funcCreate, nullptr});
+                }
+            }
+
+            void recordCollision(IdentifierView<identifierType> id){
+                if constexpr (requires { IdentifierTraits<identifierType>::collides(id, id); }){
+                    // only runs when a registration failed, so walking the registry for the stored id is fine
+                    registry.forEach([this, &id](const identifierType& stored, const registryEntry&){
+                        if (stored == id && IdentifierTraits<identifierType>::collides(stored, id)){
+                            collisions.push_back(collision{stored, identifierType(id)});
+                        }
+                    });
+                }
+            }
+
+            entryLookupType findEntry(IdentifierView<identifierType> id) const{
+                if (sealedRegistry){
+                    return entryLookupType(sealedRegistry->find(id));
+                }
+                if (replication == replicationMode::perThread){
+                    return getReplica().find(id);
+                }
+                return registry.find(id);
+            }
+
+            struct replica{
+                std::uint64_t owner = 0;
+                std::uint64_t version = 0;
+                std::unique_ptr<registryMapType> registry;
+            };
+
+            const registryMapType& getReplica() const{
+                thread_local std::vector<replica> replicas;
+                if (slot >= replicas.size()) [[unlikely]]{
+                    replicas.resize(slot + 1);
+                }
+                replica& local = replicas[slot];
+                if (local.owner != serial || local.version != version.load(std::memory_order_acquire)) [[unlikely]]{
+                    // built by this thread so the copy is allocated close to it, in the iteration order of the registry so ordered storages get their nodes laid out in id order
+                    std::lock_guard<std::mutex> lock(writeMutex);
+                    std::vector<std::pair<identifierType, registryEntry>> entries;
+                    entries.reserve(registry.size());
+                    registry.forEach([&entries](const identifierType& id, const registryEntry& entry){
+                        entries.emplace_back(id, entry);
+                    });
+                    local.registry = std::make_unique<registryMapType>();
+                    if constexpr (requires { local.registry->insertBulk(std::span<const std::pair<identifierType, registryEntry>>(entries)); }){
+                        local.registry->insertBulk(std::span<const std::pair<identifierType, registryEntry>>(entries));
+                    }else{
+                        for (const auto& [id, entry] : entries){
+                            local.registry->insert(id, entry);
+                        }
+                    }
+                    local.version = version.load(std::memory_order_relaxed);
+                    local.owner = serial;
+                }
+                return *local.registry;
+            }
+
+            static std::size_t objectInfoSize(const objectInfoType& info){
+                if constexpr (objectInfoType::supported){
+                    return info.size;
+                }
+                return 0;
+            }
+
+            static std::size_t objectInfoAlignment(const objectInfoType& info){
+                if constexpr (objectInfoType::supported){
+                    return info.alignment;
+                }
+                return 0;
+            }
+
+            std::size_t maxObjectInfo(std::size_t (*field)(const objectInfoType&)){
+                std::lock_guard<std::mutex> lock(writeMutex);
+                std::size_t ret = 0;
+                registry.forEach([&ret, field](const identifierType&, const registryEntry& entry){
+                    if (entry.info){
+                        ret = std::max(ret, field(*entry.info));
+                    }
+                });
+                return ret;
+            }
+
+            static std::size_t takeSlot(){
+                std::lock_guard<std::mutex> lock(slotMutex);
+                if (freeSlots.empty()){
+                    return nextSlot++;
+                }
+                std::size_t ret = freeSlots.back();
+                freeSlots.pop_back();
+                return ret;
+            }
+
+            inline static std::mutex slotMutex{};
+            inline static std::vector<std::size_t> freeSlots{};
+            inline static std::size_t nextSlot = 0;
+            inline static std::atomic<std::uint64_t> nextSerial{1};
+
+            registryMapType registry;
+            std::optional<sealedRegistryType> sealedRegistry;
+            std::vector<collision> collisions;
+            // incremented by every removal so libFactory::CreatorHandle can detect stale creator functions
+            std::atomic<std::uint64_t> generation{0};
+            // incremented by every modification so the thread replicas know when to copy the registry again
+            std::atomic<std::uint64_t> version{0};
+            mutable std::mutex writeMutex;
+            replicationMode replication = replicationMode::none;
+            const bool isDefault;
+            // the slot of the thread replicas of this instance, reused by later instances so serial tells the replicas apart
+            const std::size_t slot = takeSlot();
+            const std::uint64_t serial = nextSerial.fetch_add(1, std::memory_order_relaxed);
+            instrumentationType ownInstrumentation;
+        };
+    protected:
+        /**
+         * @brief function to register a creator function together with the info of the object type it creates
+         * @param id the id used to identify the object
+         * @param entry the creator function and object info
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry or the registry is sealed
+         */
+        static bool registerEntry(IdentifierView<identifierType> id, const registryEntry& entry){
+            return getDefaultInstance().registerEntry(id, entry);
+        }
+
+        /**
+         * @brief helper function to register an object type with a creator function that constructs it
+         * @tparam object the object to register
+         * @param id the id used to identify the object
+         * @param funcCreate the function used to create the object
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry or the registry is sealed
+         */
+        template<class object>
+        static bool registerObjectEntry(IdentifierView<identifierType> id, const creatorFunctionType& funcCreate){
+            return getDefaultInstance().template registerObjectEntry<object>(id, funcCreate);
+        }
+
+        /**
+         * @brief function to get the internal type registry
+         * @return reference to the type registry of the default instance
+         */
+        static registryMapType& getTypeRegistry(){
+            return getDefaultInstance().registry;
+        }
+
+        /**
+         * @brief a registration that is not in the registry yet, libFactory::staticRegister links one of these per object type into a list at static init time
+         */
+        struct pendingRegistration{
+            /**
+             * @brief function that makes the id and registry entry of the object type
+             */
+            std::pair<identifierType, registryEntry> (*makeEntry)();
+
+            /**
+             * @brief the next registration in the list
+             */
+            pendingRegistration* next;
+        };
+
+        /**
+         * @brief function to add a registration to the pending list, the default instance adds all pending registrations in one go the next time it is used
+         * @note this does not allocate and only touches constant initialized state, so it is safe to call from any static initializer
+         * @param registration the registration, has to stay alive for as long as it is pending
+         */
+        static void linkRegistration(pendingRegistration& registration){
+            registration.next = pendingRegistrations.load(std::memory_order_relaxed);
+            while (!pendingRegistrations.compare_exchange_weak(registration.next, &registration, std::memory_order_release, std::memory_order_relaxed)){}
+        }
+
+        /**
+         * @brief function to look up the registry entry of an id in the default instance, uses the sealed index if the registry is sealed
+         * @param id the id to look for
+         * @return pointer (or pointer like guard) to the registry entry
+         * @return nullptr (or an empty guard) if the id does not exist in the registry
+         */
+        static entryLookupType findEntry(IdentifierView<identifierType> id){
+            return getDefaultInstance().findEntry(id);
+        }
+
+        /**
+         * @brief the head of the pending registration list, see linkRegistration()
+         */
+        inline static constinit std::atomic<pendingRegistration*> pendingRegistrations{nullptr};
+
+        /**
+         * @brief serializes adding the pending registrations to the registry
+         */
+        inline static constinit std::mutex pendingMutex{};
+
+        /**
+         * @brief function to construct the object of a registry entry into a buffer, used by the createInto() functions of the factories
+         * @param entry the registry entry
+         * @param buffer the buffer, the object is placed at the first suitably aligned address in it
+         * @param size the size of the buffer in bytes
+         * @param args the arguments passed to the constructor
+         * @return the constructed object
+         * @return an empty libFactory::PlacedObject if the object type of the entry is unknown or does not fit into the buffer
+         */
+        template<class... argTypes>
+        static PlacedObject<baseClass> constructInto(const registryEntry& entry, void* buffer, std::size_t size, argTypes&&... args){
+            if constexpr (objectInfoType::supported){
+                if (entry.info && std::align(entry.info->alignment, entry.info->size, buffer, size)){
+                    return {entry.info->construct(buffer, std::forward<argTypes>(args)...), entry.info->destroy};
+                }
+            }
+            return {};
+        }
+    private:
+        static void addPendingRegistrations(factoryInstance& instance){
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            // the list is only emptied once its registrations are in the registry, so threads that see an empty list also see the registrations
+            pendingRegistration* added = nullptr;
+            for (;;){
+                pendingRegistration* first = pendingRegistrations.load(std::memory_order_acquire);
+                std::size_t count = 0;
+                for (pendingRegistration* registration = first; registration != added; registration = registration->next){
+                    ++count;
+                }
+                std::vector<std::pair<identifierType, registryEntry>> entries;
+                entries.reserve(count);
+                for (pendingRegistration* registration = first; registration != added; registration = registration->next){
+                    entries.push_back(registration->makeEntry());
+                }
+                // the list is in reverse link order, restore it so the first registration of an id wins like with registerCreatorFunc()
+                std::reverse(entries.begin(), entries.end());
+                {
+                    std::lock_guard<std::mutex> writeLock(instance.writeMutex);
+                    if (!instance.sealedRegistry){
+                        if constexpr (requires { instance.registry.insertBulk(std::span<const std::pair<identifierType, registryEntry>>(entries)); }){
+                            if (instance.registry.insertBulk(std::span<const std::pair<identifierType, registryEntry>>(entries)) != entries.size()){
+                                for (const auto& [id, entry] : entries){
+                                    instance.recordCollision(id);
+                                }
+                            }
+                        }else{
+                            for (const auto& [id, entry] : entries){
+                                if (!instance.registry.insert(id, entry)){
+                                    instance.recordCollision(id);
+                                }
+                            }
+                        }
+                        instance.version.fetch_add(1, std::memory_order_release);
+                    }
+                }
+                added = first;
+                if (pendingRegistrations.compare_exchange_strong(first, nullptr, std::memory_order_release, std::memory_order_acquire)){
+                    return;
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief helper class to register an object with a factory, the intended use of this class is to inherit it in your class publicly and then it will register the class at static init time
+     * @note the object to be registered has to implement a static getFactoryID() method that returns the factory ID of the object and implement the static create function that will be used as the object creator function
+     * @note if the object can be constructed from the creator function arguments its size and alignment are recorded as well, so createInto() and createBatch() construct it directly with that constructor instead of calling create
+     * @warning sometimes the compiler will automatically not compile this class and therefore not register the object, to aviod this add `assert(libFactory_bRegistered) at the top of the object constructor`
+     * @tparam factory the factory to register the object with
+     * @tparam object the object to be registered, read note section for requirements
+     * @see GoogleTests/autoRegistrationTests.cpp
+     */
+    template<class factory, class object>
+    class autoRegister{
+    public:
+
+    protected:
+        static bool libFactory_bRegistered;
+    private:
+        static bool _registerWithFactory_(){
+            if constexpr (factory::objectInfoType::supported){
+                if constexpr (factory::objectInfoType::template constructible<object>){
+                    return factory::template registerObjectEntry<object>(object::getFactoryID(), object::create);
+                }
+            }
+            return factory::registerCreatorFunc(object::getFactoryID(), object::create);
+        }
+    };
+    template<class factory, class object>
+    bool autoRegister<factory, object>::libFactory_bRegistered = autoRegister<factory, object>::_registerWithFactory_();
+
+    /**
+     * @brief helper class to register an object with a factory without doing any work at static init time, used like libFactory::autoRegister
+     *
+     * @details
+     * every object type contributes one constant initialized node to an intrusive list of the factory, the only thing that runs at static init time is linking that node into the list, which is a single pointer swap that does not allocate.
+     * the first time the registry is used (create(), registerCreatorFunc(), seal(), ...) all pending registrations are added to it in one bulk insert (see insertBulk() of the storage policies),
+     * so startup does not pay for one registry insert and allocation per type and nothing depends on the order the static initializers run in
      *
-     * @tparam baseClass the base class of all the constructed objects
-     * @tparam creatorFunctionType the type definition of the creator functions that get registered
+     * like with autoRegister the first registration of an id wins, later registrations with the same id are dropped, registrations that are linked after the registry was sealed are dropped as well
+     *
+     * @note the object to be registered has to implement a static getFactoryID() method that returns the factory ID of the object and implement the static create function that will be used as the object creator function
+     * @note if the object can be constructed from the creator function arguments its size and alignment are recorded as well, so createInto() and createBatch() construct it directly with that constructor instead of calling create
+     * @warning the compiler only instantiates the registration if libFactory_bRegistered is used, to make sure it is add `static_cast<void>(libFactory_bRegistered)` or `assert(libFactory_bRegistered)` to the object constructor
+     * @tparam factory the factory to register the object with
+     * @tparam object the object to be registered, read note section for requirements
+     * @see GoogleTests/staticRegistrationTests.cpp
+     */
+    template<class factory, class object>
+    class staticRegister{
+    private:
+        static std::pair<typename factory::factoryIdentifierType, typename factory::registryEntry> _makeEntry_(){
+            if constexpr (factory::objectInfoType::supported){
+                if constexpr (factory::objectInfoType::template constructible<object>){
+                    return {object::getFactoryID(), {object::create, factory::objectInfoType::template of<object>()}};
+                }
+            }
+            return {object::getFactoryID(), {object::create, nullptr}};
+        }
+    protected:
+        static inline constinit typename factory::pendingRegistration libFactory_registration{&_makeEntry_, nullptr};
+        static inline const bool libFactory_bRegistered = (factory::linkRegistration(libFactory_registration), true);
+    };
+
+    /**
+     * @brief a basic factory that uses 0 argument creator functions
+     * @details the creator functions are stored as libFactory::InplaceCreator, so besides plain functions they can be lambdas that capture state (a config, a shared resource) as long as the captures fit into its inline buffer
+     * @tparam baseClass the base class of all created objects
      * @tparam identifierType the type of the identifier used to identify what object to create, uses baseClass::__factoryIdentifierType__ if not defined
+     * @tparam functorReturn the return type of the creator functions
+     * @tparam registryStorage the storage policy used for the registry, uses libFactory::AutoStorage if not defined
+     * @tparam instrumentation the instrumentation policy that create() reports to, uses libFactory::NoInstrumentation if not defined (see libFactory::CreationMetrics)
+     *
+     * @see GoogleTests/basicFactoryTests.cpp
      */
-    template<class baseClass, typename creatorFunctionType, class identifierType = typename baseClass::__factoryIdentifierType__>
-    class FactoryBase{
+    template<class baseClass, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>, template<class, class> class registryStorage = AutoStorage, template<class> class instrumentation = NoInstrumentation>
+    class BasicFactory: public FactoryBase<baseClass, InplaceCreator<functorReturn()>, identifierType, registryStorage, instrumentation>{
     public:
         /**
-         * @brief function to register a creator function to create an object
-         * @param id the id used to identify the object
-         * @param funcCreate the function used to create the object
+         * @brief function to create a object from its id
+         * @param id the id of the object
+         * @return the return value of the creator function
+         * @return nullptr if the id does not exist in the registry
+         */
+        static functorReturn create(IdentifierView<identifierType> id){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return entry->creator(); // call the createFunc
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return nullptr;
+        }
+
+        /**
+         * @brief function to construct a object from its id into a buffer provided by the caller instead of allocating it
+         * @note only works for object types registered with a registration helper (or autoRegister), use maxObjectSize() and maxObjectAlignment() to size the buffer
+         * @param id the id of the object
+         * @param buffer the buffer, the object is placed at the first suitably aligned address in it
+         * @param size the size of the buffer in bytes
+         * @return the object and its destroy function, the caller has to call destroy before reusing or freeing the buffer
+         * @return an empty libFactory::PlacedObject if the id does not exist in the registry, its object type is unknown or it does not fit into the buffer
+         */
+        static PlacedObject<baseClass> createInto(IdentifierView<identifierType> id, void* buffer, std::size_t size){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return baseFactory::constructInto(*entry, buffer, size);
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return {};
+        }
+
+        /**
+         * @brief function to create count objects of one id in one call
+         *
+         * @details
+         * the id is only looked up once, if the object type was registered with registerObject() or registerPooledObject() all objects are constructed into one contiguous block,
+         * otherwise the creator function is called count times
+         *
+         * @param id the id of the objects
+         * @param count the amount of objects to create
+         * @return a batch that owns the created objects
+         * @return an empty batch if the id does not exist in the registry
+         */
+        static ObjectBatch<baseClass, functorReturn> createBatch(IdentifierView<identifierType> id, std::size_t count){
+            ObjectBatch<baseClass, functorReturn> ret;
+            if (auto entry = baseFactory::findEntry(id)){
+                appendToBatch(ret, *entry, count);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to create an object for every id of a range, lazily while the stream is consumed
+         *
+         * @details
+         * each object is created when the stream gets to it, the same way create() would create it, nullptr for ids that do not exist in the registry.
+         * the creator function of the last id is kept, so runs of equal ids are only looked up once (see libFactory::CreatorHandle)
+         *
+         * @code
+         * for (auto object : factory::createStream(ids | std::views::take(100))){ ... }
+         * @endcode
+         *
+         * @param ids range of ids, an lvalue range is referenced and has to outlive the stream, an rvalue range is moved into the stream
+         * @return a libFactory::ObjectStream of the objects in the order of ids
+         */
+        template<std::ranges::input_range idRange>
+        static ObjectStream<functorReturn> createStream(idRange&& ids){
+            return streamObjects(std::views::all(std::forward<idRange>(ids)));
+        }
+
+        /**
+         * @brief function to create one object for every id in ids
+         *
+         * @details
+         * the ids are grouped internally so every distinct id is only looked up once and its objects are constructed into one contiguous block (see createBatch(const identifierType&, std::size_t))
+         *
+         * @note the ids are grouped by sorting, so identifierType has to be less than comparable
+         * @param ids the ids of the objects
+         * @return a batch that owns the created objects, the objects are in the same order as ids and are nullptr for ids that do not exist in the registry
+         */
+        static ObjectBatch<baseClass, functorReturn> createBatch(std::span<const identifierType> ids){
+            ObjectBatch<baseClass, functorReturn> ret;
+            std::vector<std::size_t> order(ids.size());
+            for (std::size_t i = 0; i < ids.size(); i++){
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(), [&ids](std::size_t a, std::size_t b){ return ids[a] < ids[b]; });
+
+            for (std::size_t groupStart = 0; groupStart < order.size();){
+                std::size_t groupEnd = groupStart + 1;
+                while (groupEnd < order.size() && !(ids[order[groupStart]] < ids[order[groupEnd]])){
+                    groupEnd++;
+                }
+                if (auto entry = baseFactory::findEntry(ids[order[groupStart]])){
+                    appendToBatch(ret, *entry, groupEnd - groupStart);
+                }else{
+                    for (std::size_t i = groupStart; i < groupEnd; i++){
+                        ret.appendMissing();
+                    }
+                }
+                groupStart = groupEnd;
+            }
+            ret.reorder(order);
+            return ret;
+        }
+
+        /**
+         * @brief helper function to register an object with the factory
+         * @warning the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerObject(identifierType id)
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerObject(){
+            return registerObject<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register an object with the factory
+         * @param id the id to register the object under
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerObject(IdentifierView<identifierType> id){
+            return baseFactory::template registerObjectEntry<object>(id, [](){return functorReturn(new object()); });
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool instead of with new
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn, the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerPooledObject(identifierType id)
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerPooledObject(){
+            return registerPooledObject<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool instead of with new
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn
+         * @param id the id to register the object under
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerPooledObject(IdentifierView<identifierType> id){
+            static_assert(std::is_same_v<functorReturn, FactoryPtr<baseClass>>, "libFactory: pooled objects need a factory with libFactory::FactoryPtr<baseClass> as functorReturn");
+            return baseFactory::template registerObjectEntry<object>(id, [](){return ObjectPool<object>::template make<baseClass>(); });
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets recycled instead of destroyed, see registerRecycledObject(identifierType id)
+         * @note the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerRecycledObject(identifierType id)
+         * @tparam object the object to register
          * @return true if the function was registered
          * @return false if the id already exists in the registry
          */
-        static bool registerCreatorFunc(const identifierType& id, const creatorFunctionType& funcCreate){
-            auto& reg = getTypeRegistry();
-            if (auto it = reg.find(id); it == reg.end())
-            { // C++17 init-if ^^
-                reg[id] = funcCreate;
-                return true;
+        template<class object>
+        static bool registerRecycledObject(){
+            return registerRecycledObject<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets recycled instead of destroyed
+         *
+         * @details
+         * when a created object is released it is reset() and kept on a freelist of the thread that created it, create() takes objects from that freelist before it constructs new ones (see libFactory::ObjectRecycler).
+         * this is for objects that are created and released in a tight loop and are expensive to construct, for example because they allocate buffers that reset() can keep
+         *
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn, the object has to implement reset() which puts it back into the state of a new object
+         * @note createBatch() and createInto() construct new objects for the id as usual
+         * @param id the id to register the object under
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerRecycledObject(IdentifierView<identifierType> id){
+            static_assert(std::is_same_v<functorReturn, FactoryPtr<baseClass>>, "libFactory: recycled objects need a factory with libFactory::FactoryPtr<baseClass> as functorReturn");
+            static_assert(requires(object& o){ o.reset(); }, "libFactory: recycled objects have to implement reset()");
+            return baseFactory::template registerObjectEntry<object>(id, [](){return ObjectRecycler<object>::template make<baseClass>(); });
+        }
+
+        /**
+         * @brief helper function to register a default constructed prototype of an object with the factory
+         * @note the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerPrototype(identifierType id, prototypeArgs&&... args)
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         * @see registerPrototype(identifierType id, prototypeArgs&&... args)
+         */
+        template<class object>
+        static bool registerPrototype(){
+            return registerPrototype<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register a prototype of an object with the factory, create() then copies the prototype instead of running the constructor again
+         *
+         * @details
+         * the prototype is constructed once from args when registering and shared by all copies of the creator,
+         * create() calls object::clone() if the object implements it and copy constructs the prototype otherwise.
+         * clone() has to be const and return something that functorReturn can be constructed from (e.g. baseClass* or std::unique_ptr<baseClass>)
+         *
+         * @note objects registered as prototypes are not constructed into one contiguous block by createBatch(), every object is copied on its own
+         * @warning the prototype is copied concurrently if create() is called from multiple threads, its copy constructor or clone() must not modify it
+         * @param id the id to register the object under
+         * @param args the arguments passed to the constructor of the prototype
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object, class... prototypeArgs>
+        static bool registerPrototype(IdentifierView<identifierType> id, prototypeArgs&&... args){
+            auto prototype = std::make_shared<const object>(std::forward<prototypeArgs>(args)...);
+            if constexpr (requires(const object& o){ functorReturn(o.clone()); }){
+                return baseFactory::registerCreatorFunc(id, [prototype](){return functorReturn(prototype->clone()); });
+            }else{
+                static_assert(std::is_copy_constructible_v<object>, "libFactory: prototypes have to be copy constructible or implement clone()");
+                return baseFactory::registerCreatorFunc(id, [prototype](){return functorReturn(new object(*prototype)); });
             }
-            return false;
         }
 
         /**
-         * @brief function to remove a creator function from the registry
-         * @param id id of the function to remove
-         * @return true if the function was removed
-         * @return false if the id does not exist in the registry
+         * @brief how createShared() keeps the shared instances
          */
-        static bool removeCreatorFunc(const identifierType& id){
-            auto& reg = getTypeRegistry();
-            if(auto it = reg.find(id); it != reg.end()){
-                reg.erase(id);
-                return true;
+        enum class sharingMode{
+            /**
+             * @brief the instances are kept until clearSharedInstances() is called
+             */
+            strong,
+            /**
+             * @brief the instances are released once the last std::shared_ptr to them is gone and constructed again by the next createShared() call
+             */
+            weak
+        };
+
+        /**
+         * @brief function to get the shared instance of an id, for ids of stateless or immutable objects that do not need an object per caller
+         *
+         * @details
+         * the first call for an id creates the object with the creator function of the id, every later call returns the same object as long as it is cached (see setSharingMode()).
+         * when multiple threads call this for an id that is not cached yet one of them creates the object and the others wait for it, calls for other ids are not blocked meanwhile.
+         * if the creator function throws the exception is passed on and the next call tries again
+         *
+         * @note the cache is separate from the registry, removeCreatorFunc() and clearRegistry() do not release cached instances, see clearSharedInstances()
+         * @note functorReturn has to be a smart pointer that std::shared_ptr can take ownership from, like std::unique_ptr or libFactory::FactoryPtr
+         * @param id the id of the object
+         * @return the shared instance
+         * @return nullptr if the id does not exist in the registry
+         * @see GoogleTests/sharedInstanceTests.cpp
+         */
+        static std::shared_ptr<const baseClass> createShared(IdentifierView<identifierType> id){
+            static_assert(!std::is_pointer_v<functorReturn> && std::is_constructible_v<std::shared_ptr<const baseClass>, functorReturn&&>, "libFactory: createShared() needs a functorReturn that owns the object");
+            auto& cache = getSharedCache();
+            {
+                std::shared_lock<std::shared_mutex> lock(cache.mutex);
+                if (auto it = cache.slots.find(id); it != cache.slots.end()){
+                    if (auto ret = it->second->instance.lock()){
+                        return ret;
+                    }
+                }
             }
-            return false;
+            return createSharedSlow(id);
         }
 
         /**
-         * @brief function to clear the registry
+         * @brief function to set how createShared() keeps the shared instances
+         * @note switching to sharingMode::weak releases the instances that are not used anymore
+         * @param mode the sharing mode
          */
-        static void clearRegistry(){
-            auto& reg = getTypeRegistry();
-            reg.clear();
+        static void setSharingMode(sharingMode mode){
+            auto& cache = getSharedCache();
+            std::unique_lock<std::shared_mutex> lock(cache.mutex);
+            cache.mode = mode;
+            if (mode == sharingMode::weak){
+                for (auto& [slotID, slot] : cache.slots){
+                    slot->keepAlive.reset();
+                }
+            }
+        }
+
+        /**
+         * @brief function to release all shared instances, the next createShared() call of every id creates a new object
+         * @note objects that are still referenced stay alive until their last std::shared_ptr is gone
+         */
+        static void clearSharedInstances(){
+            auto& cache = getSharedCache();
+            std::unique_lock<std::shared_mutex> lock(cache.mutex);
+            cache.slots.clear();
+        }
+
+        /**
+         * @brief function to get the amount of shared instances that are alive
+         * @return the amount of ids whose shared instance is cached and alive
+         */
+        static std::size_t getSharedInstanceCount(){
+            auto& cache = getSharedCache();
+            std::shared_lock<std::shared_mutex> lock(cache.mutex);
+            return static_cast<std::size_t>(std::count_if(cache.slots.begin(), cache.slots.end(), [](const auto& slot){ return !slot.second->instance.expired(); }));
         }
     protected:
         /**
-         * @brief the registry map typedef
+         * @brief typedef for the underlying factory base class
          */
-        typedef std::map<identifierType, creatorFunctionType> registryMapType;
+        typedef FactoryBase<baseClass, InplaceCreator<functorReturn()>, identifierType, registryStorage, instrumentation> baseFactory;
 
         /**
-         * @brief function to get the internal type registry
-         * @return reference to the type registry
+         * @brief the coroutine of createStream()
          */
-        static registryMapType& getTypeRegistry(){
-            static registryMapType typeRegistry;
-            return typeRegistry;
+        template<class idView>
+        static ObjectStream<functorReturn> streamObjects(idView ids){
+            std::optional<identifierType> lastId;
+            typename baseFactory::creatorHandleType creator;
+            for (auto&& element : ids){
+                IdentifierView<identifierType> id = element;
+                if (!lastId || !(*lastId == id) || !creator.valid()){
+                    creator = baseFactory::resolve(id);
+                    if (lastId){
+                        *lastId = id;
+                    }else{
+                        lastId.emplace(id);
+                    }
+                }
+                co_yield createResolved(creator, id);
+            }
         }
-    };
 
-    /**
-     * @brief helper class to register an object with a factory, the intended use of this class is to inherit it in your class publicly and then it will register the class at static init time
-     * @note the object to be registered has to implement a static getFactoryID() method that returns the factory ID of the object and implement the static create function that will be used as the object creator function
-     * @warning sometimes the compiler will automatically not compile this class and therefore not register the object, to aviod this add `assert(libFactory_bRegistered) at the top of the object constructor`
-     * @tparam factory the factory to register the object with
-     * @tparam object the object to be registered, read note section for requirements
-     * @see GoogleTests/autoRegistrationTests.cpp
-     */
-    template<class factory, class object>
-    class autoRegister{
-    public:
+        /**
+         * @brief calls a resolved creator function and reports it to the instrumentation like create()
+         */
+        static functorReturn createResolved(const typename baseFactory::creatorHandleType& creator, IdentifierView<identifierType> id){
+            if (creator.valid()){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return creator();
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return nullptr;
+        }
 
-    protected:
-        static bool libFactory_bRegistered;
-    private:
-        static bool _registerWithFactory_(){
-            return factory::registerCreatorFunc(object::getFactoryID(), object::create);
+        /**
+         * @brief the shared instance of one id, see createShared()
+         */
+        struct sharedSlot{
+            /**
+             * @brief serializes creating the instance
+             */
+            std::mutex createMutex;
+
+            /**
+             * @brief the instance, written while the cache is locked exclusively
+             */
+            std::weak_ptr<const baseClass> instance;
+
+            /**
+             * @brief keeps the instance alive in sharingMode::strong
+             */
+            std::shared_ptr<const baseClass> keepAlive;
+        };
+
+        /**
+         * @brief the shared instances of the factory
+         */
+        struct sharedCache{
+            std::shared_mutex mutex;
+            // the slots are shared so a thread that creates an instance can keep its slot while clearSharedInstances() runs
+            std::map<identifierType, std::shared_ptr<sharedSlot>, std::less<>> slots;
+            sharingMode mode = sharingMode::strong;
+        };
+
+        /**
+         * @brief function to get the shared instance cache
+         * @return reference to the cache
+         */
+        static sharedCache& getSharedCache(){
+            static sharedCache cache;
+            return cache;
+        }
+
+        /**
+         * @brief function to create the shared instance of an id that is not cached
+         */
+        static std::shared_ptr<const baseClass> createSharedSlow(IdentifierView<identifierType> id){
+            if (!baseFactory::findEntry(id)){
+                // no slot for unknown ids, so looking up garbage ids does not grow the cache
+                baseFactory::getInstrumentation().miss(id);
+                return nullptr;
+            }
+            auto& cache = getSharedCache();
+            std::shared_ptr<sharedSlot> slot;
+            {
+                std::unique_lock<std::shared_mutex> lock(cache.mutex);
+                auto it = cache.slots.find(id);
+                if (it == cache.slots.end()){
+                    it = cache.slots.emplace(identifierType(id), std::make_shared<sharedSlot>()).first;
+                }
+                slot = it->second;
+            }
+            std::lock_guard<std::mutex> createLock(slot->createMutex);
+            {
+                // another thread may have created the instance while this one waited
+                std::shared_lock<std::shared_mutex> lock(cache.mutex);
+                if (auto ret = slot->instance.lock()){
+                    return ret;
+                }
+            }
+            std::shared_ptr<const baseClass> ret(create(id));
+            if (ret){
+                std::unique_lock<std::shared_mutex> lock(cache.mutex);
+                slot->instance = ret;
+                if (cache.mode == sharingMode::strong){
+                    slot->keepAlive = ret;
+                }
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to create count objects from a registry entry and append them to a batch
+         */
+        template<class entryType>
+        static void appendToBatch(ObjectBatch<baseClass, functorReturn>& batch, const entryType& entry, std::size_t count){
+            if (entry.info){
+                batch.appendBlock(*entry.info, count, [&entry](void* memory, std::size_t){ return entry.info->construct(memory); });
+            }else{
+                for (std::size_t i = 0; i < count; i++){
+                    batch.append(entry.creator());
+                }
+            }
         }
     };
-    template<class factory, class object>
-    bool autoRegister<factory, object>::libFactory_bRegistered = autoRegister<factory, object>::_registerWithFactory_();
 
     /**
-     * @brief a basic factory that uses 0 argument creator functions
+     * @brief a basic factory that uses 1 argument creator functions
+     * @details the creator functions are stored as libFactory::InplaceCreator, so besides plain functions they can be lambdas that capture state as long as the captures fit into its inline buffer
      * @tparam baseClass the base class of all created objects
+     * @tparam arg1Type the argument type of the first argument passed to the creator functions
      * @tparam identifierType the type of the identifier used to identify what object to create, uses baseClass::__factoryIdentifierType__ if not defined
      * @tparam functorReturn the return type of the creator functions
+     * @tparam registryStorage the storage policy used for the registry, uses libFactory::AutoStorage if not defined
+     * @tparam instrumentation the instrumentation policy that create() reports to, uses libFactory::NoInstrumentation if not defined (see libFactory::CreationMetrics)
      *
-     * @see GoogleTests/basicFactoryTests.cpp
+     * @note arg1Type is copied on its way to the constructor, use libFactory::ArgumentFactory for heavy or move only arguments
+     * @see GoogleTests/singleArgumentFactoryTests.cpp
      */
-    template<class baseClass, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>>
-    class BasicFactory: public FactoryBase<baseClass, functorReturn (*)(void), identifierType>{
+    template<class baseClass, class arg1Type, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>, template<class, class> class registryStorage = AutoStorage, template<class> class instrumentation = NoInstrumentation>
+    class SingleArgumentFactory: public FactoryBase<baseClass, InplaceCreator<functorReturn(arg1Type)>, identifierType, registryStorage, instrumentation>{
     public:
         /**
          * @brief function to create a object from its id
@@ -118,99 +3679,418 @@ namespace libFactory{
          * @return the return value of the creator function
          * @return nullptr if the id does not exist in the registry
          */
-        static functorReturn create(identifierType id){
-            auto& reg =  baseFactory::getTypeRegistry();
-            if (auto it = reg.find(id); it != reg.end()){
-                return it->second(); // call the createFunc
+        static functorReturn create(IdentifierView<identifierType> id, arg1Type arg1){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return entry->creator(arg1); // call the createFunc
             }
+            baseFactory::getInstrumentation().miss(id);
             return nullptr;
         }
 
         /**
-         * @brief helper function to register an object with the factory
-         * @warning the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerObject(identifierType id)
+         * @brief function to construct a object from its id into a buffer provided by the caller instead of allocating it
+         * @note only works for object types registered with a registration helper (or autoRegister), use maxObjectSize() and maxObjectAlignment() to size the buffer
+         * @param arg1 the argument passed to the constructor
+         * @param id the id of the object
+         * @param buffer the buffer, the object is placed at the first suitably aligned address in it
+         * @param size the size of the buffer in bytes
+         * @return the object and its destroy function, the caller has to call destroy before reusing or freeing the buffer
+         * @return an empty libFactory::PlacedObject if the id does not exist in the registry, its object type is unknown or it does not fit into the buffer
+         */
+        static PlacedObject<baseClass> createInto(IdentifierView<identifierType> id, void* buffer, std::size_t size, arg1Type arg1){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return baseFactory::constructInto(*entry, buffer, size, arg1);
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return {};
+        }
+
+        /**
+         * @brief function to create one object of one id for every argument in args
+         *
+         * @details
+         * the id is only looked up once, if the object type was registered with registerObjectConstructor() or registerPooledObjectConstructor() all objects are constructed into one contiguous block,
+         * otherwise the creator function is called for every argument
+         *
+         * @param id the id of the objects
+         * @param args range of the arguments, one object is created for every element
+         * @return a batch that owns the created objects in the same order as args
+         * @return an empty batch if the id does not exist in the registry
+         */
+        template<class argumentRange>
+        static ObjectBatch<baseClass, functorReturn> createBatch(IdentifierView<identifierType> id, const argumentRange& args){
+            ObjectBatch<baseClass, functorReturn> ret;
+            if (auto entry = baseFactory::findEntry(id)){
+                if (entry->info){
+                    auto it = std::begin(args);
+                    ret.appendBlock(*entry->info, static_cast<std::size_t>(std::distance(std::begin(args), std::end(args))), [&entry, &it](void* memory, std::size_t){ return entry->info->construct(memory, *it++); });
+                }else{
+                    for (const auto& arg1 : args){
+                        ret.append(entry->creator(arg1));
+                    }
+                }
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to create an object for every id and argument pair of a range, lazily while the stream is consumed
+         *
+         * @details
+         * the elements of the range are tuple like (for example std::pair) with the id first and the argument second,
+         * each object is created when the stream gets to it, the same way create() would create it, nullptr for ids that do not exist in the registry.
+         * the creator function of the last id is kept, so runs of equal ids are only looked up once (see libFactory::CreatorHandle)
+         *
+         * @param elements range of id and argument pairs, an lvalue range is referenced and has to outlive the stream, an rvalue range is moved into the stream
+         * @return a libFactory::ObjectStream of the objects in the order of elements
+         */
+        template<std::ranges::input_range elementRange>
+        static ObjectStream<functorReturn> createStream(elementRange&& elements){
+            return streamObjects(std::views::all(std::forward<elementRange>(elements)));
+        }
+
+        /**
+         * @brief helper function to register an object with the factory and pass the create() arguments to the constructor
+         * @note the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerObject(identifierType id)
          * @tparam object the object to register
          * @return true if the function was registered
          * @return false if the id already exists in the registry
          */
         template<class object>
-        static bool registerObject(){
-            return baseFactory::registerCreatorFunc(object::getFactoryID(), [](){return std::unique_ptr<baseClass>(new object()); });
+        static bool registerObjectConstructor(){
+            return registerObjectConstructor<object>(object::getFactoryID());
         }
 
         /**
-         * @brief helper function to register an object with the factory
+         * @brief helper function to register an object with the factory and pass the create() arguments to the constructor
+         * @param id the id to register the object under
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerObjectConstructor(IdentifierView<identifierType> id){
+            return baseFactory::template registerObjectEntry<object>(id, [](arg1Type arg1){return functorReturn(new object(arg1)); });
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool and pass the create() arguments to the constructor
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn, the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerPooledObjectConstructor(identifierType id)
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerPooledObjectConstructor(){
+            return registerPooledObjectConstructor<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool and pass the create() arguments to the constructor
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn
          * @param id the id to register the object under
          * @tparam object the object to register
          * @return true if the function was registered
          * @return false if the id already exists in the registry
          */
         template<class object>
-        static bool registerObject(identifierType id){
-            return baseFactory::registerCreatorFunc(id, [](){return std::unique_ptr<baseClass>(new object()); });
+        static bool registerPooledObjectConstructor(IdentifierView<identifierType> id){
+            static_assert(std::is_same_v<functorReturn, FactoryPtr<baseClass>>, "libFactory: pooled objects need a factory with libFactory::FactoryPtr<baseClass> as functorReturn");
+            return baseFactory::template registerObjectEntry<object>(id, [](arg1Type arg1){return ObjectPool<object>::template make<baseClass>(arg1); });
         }
     protected:
         /**
          * @brief typedef for the underlying factory base class
          */
-        typedef FactoryBase<baseClass, functorReturn (*)(void), identifierType> baseFactory;
+        typedef FactoryBase<baseClass, InplaceCreator<functorReturn(arg1Type)>, identifierType, registryStorage, instrumentation> baseFactory;
+
+        /**
+         * @brief the coroutine of createStream()
+         */
+        template<class elementView>
+        static ObjectStream<functorReturn> streamObjects(elementView elements){
+            std::optional<identifierType> lastId;
+            typename baseFactory::creatorHandleType creator;
+            for (auto&& element : elements){
+                IdentifierView<identifierType> id = std::get<0>(element);
+                if (!lastId || !(*lastId == id) || !creator.valid()){
+                    creator = baseFactory::resolve(id);
+                    if (lastId){
+                        *lastId = id;
+                    }else{
+                        lastId.emplace(id);
+                    }
+                }
+                co_yield createResolved(creator, id, std::get<1>(element));
+            }
+        }
+
+        /**
+         * @brief calls a resolved creator function and reports it to the instrumentation like create()
+         */
+        static functorReturn createResolved(const typename baseFactory::creatorHandleType& creator, IdentifierView<identifierType> id, arg1Type arg1){
+            if (creator.valid()){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return creator(arg1);
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return nullptr;
+        }
     };
 
     /**
-     * @brief a basic factory that uses 1 argument creator functions
+     * @brief a factory with creator functions that take any number of arguments
+     *
+     * @details
+     * the signature lists the argument types the way create() takes them, arguments declared as references (including rvalue references) are passed through as references and by value arguments are taken by value once,
+     * from there on every argument is forwarded with its value category so by value and rvalue reference arguments are moved into the constructor and never copied again, this also makes move only argument types work
+     *
+     * the creator functions get called with their arguments as argTypes&&..., registerObjectConstructor() generates creators that forward them straight into the constructor
+     *
+     * @note this is the variadic replacement for libFactory::SingleArgumentFactory, ArgumentFactory<baseClass, std::unique_ptr<baseClass>(arg1Type)> behaves like SingleArgumentFactory<baseClass, arg1Type> without the extra copies
      * @tparam baseClass the base class of all created objects
-     * @tparam arg1Type the argument type of the first argument passed to the creator functions
+     * @tparam signature the signature of create() without the id as a function type, functorReturn(argTypes...)
      * @tparam identifierType the type of the identifier used to identify what object to create, uses baseClass::__factoryIdentifierType__ if not defined
-     * @tparam functorReturn the return type of the creator functions
+     * @tparam registryStorage the storage policy used for the registry, uses libFactory::AutoStorage if not defined
+     * @tparam instrumentation the instrumentation policy that create() reports to, uses libFactory::NoInstrumentation if not defined (see libFactory::CreationMetrics)
      *
-     * @see GoogleTests/singleArgumentFactoryTests.cpp
+     * @see GoogleTests/argumentFactoryTests.cpp
      */
-    template<class baseClass, class arg1Type, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>>
-    class SingleArgumentFactory: public FactoryBase<baseClass, functorReturn (*)(arg1Type), identifierType>{
+    template<class baseClass, typename signature, class identifierType = typename baseClass::__factoryIdentifierType__, template<class, class> class registryStorage = AutoStorage, template<class> class instrumentation = NoInstrumentation>
+    class ArgumentFactory;
+
+    template<class baseClass, typename functorReturn, class... argTypes, class identifierType, template<class, class> class registryStorage, template<class> class instrumentation>
+    class ArgumentFactory<baseClass, functorReturn(argTypes...), identifierType, registryStorage, instrumentation>: public FactoryBase<baseClass, InplaceCreator<functorReturn(argTypes&&...)>, identifierType, registryStorage, instrumentation>{
     public:
         /**
          * @brief function to create a object from its id
          * @param id the id of the object
+         * @param args the arguments that get forwarded to the creator function
          * @return the return value of the creator function
          * @return nullptr if the id does not exist in the registry
          */
-        static functorReturn create(identifierType id, arg1Type arg1){
-            auto& reg =  baseFactory::getTypeRegistry();
-            if (auto it = reg.find(id); it != reg.end()){
-                return it->second(arg1); // call the createFunc
+        static functorReturn create(IdentifierView<identifierType> id, argTypes... args){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return entry->creator(std::forward<argTypes>(args)...); // call the createFunc
             }
+            baseFactory::getInstrumentation().miss(id);
             return nullptr;
         }
 
         /**
-         * @brief helper function to register an object with the factory and pass the create() arguments to the constructor
-         * @note the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerObject(identifierType id)
+         * @brief function to construct a object from its id into a buffer provided by the caller instead of allocating it
+         * @note only works for object types registered with a registration helper (or autoRegister), use maxObjectSize() and maxObjectAlignment() to size the buffer
+         * @param args the arguments that get forwarded to the constructor
+         * @param id the id of the object
+         * @param buffer the buffer, the object is placed at the first suitably aligned address in it
+         * @param size the size of the buffer in bytes
+         * @return the object and its destroy function, the caller has to call destroy before reusing or freeing the buffer
+         * @return an empty libFactory::PlacedObject if the id does not exist in the registry, its object type is unknown or it does not fit into the buffer
+         */
+        static PlacedObject<baseClass> createInto(IdentifierView<identifierType> id, void* buffer, std::size_t size, argTypes... args){
+            if (auto entry = baseFactory::findEntry(id)){
+                [[maybe_unused]] auto scope = baseFactory::getInstrumentation().hit(id);
+                return baseFactory::constructInto(*entry, buffer, size, std::forward<argTypes>(args)...);
+            }
+            baseFactory::getInstrumentation().miss(id);
+            return {};
+        }
+
+        /**
+         * @brief helper function to register an object with the factory and forward the create() arguments to the constructor
+         * @note the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerObjectConstructor(identifierType id)
          * @tparam object the object to register
          * @return true if the function was registered
          * @return false if the id already exists in the registry
          */
         template<class object>
         static bool registerObjectConstructor(){
-            return baseFactory::registerCreatorFunc(object::getFactoryID(), [](arg1Type arg1){return std::unique_ptr<baseClass>(new object(arg1)); });
+            return registerObjectConstructor<object>(object::getFactoryID());
         }
 
         /**
-         * @brief helper function to register an object with the factory and pass the create() arguments to the constructor
+         * @brief helper function to register an object with the factory and forward the create() arguments to the constructor
+         * @param id the id to register the object under
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerObjectConstructor(IdentifierView<identifierType> id){
+            return baseFactory::template registerObjectEntry<object>(id, [](argTypes&&... args){return functorReturn(new object(std::forward<argTypes>(args)...)); });
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool and forward the create() arguments to the constructor
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn, the object that is being registered has to implement the getFactoryID() function to use this function, if that is not implemented then use registerPooledObjectConstructor(identifierType id)
+         * @tparam object the object to register
+         * @return true if the function was registered
+         * @return false if the id already exists in the registry
+         */
+        template<class object>
+        static bool registerPooledObjectConstructor(){
+            return registerPooledObjectConstructor<object>(object::getFactoryID());
+        }
+
+        /**
+         * @brief helper function to register an object with the factory that gets created in a libFactory::ObjectPool and forward the create() arguments to the constructor
+         * @note the factory has to use libFactory::FactoryPtr<baseClass> as functorReturn
          * @param id the id to register the object under
          * @tparam object the object to register
          * @return true if the function was registered
          * @return false if the id already exists in the registry
          */
         template<class object>
-        static bool registerObjectConstructor(identifierType id){
-            return baseFactory::registerCreatorFunc(id, [](arg1Type arg1){return std::unique_ptr<baseClass>(new object(arg1)); });
+        static bool registerPooledObjectConstructor(IdentifierView<identifierType> id){
+            static_assert(std::is_same_v<functorReturn, FactoryPtr<baseClass>>, "libFactory: pooled objects need a factory with libFactory::FactoryPtr<baseClass> as functorReturn");
+            return baseFactory::template registerObjectEntry<object>(id, [](argTypes&&... args){return ObjectPool<object>::template make<baseClass>(std::forward<argTypes>(args)...); });
         }
     protected:
         /**
          * @brief typedef for the underlying factory base class
          */
-        typedef FactoryBase<baseClass, functorReturn (*)(arg1Type), identifierType> baseFactory;
+        typedef FactoryBase<baseClass, InplaceCreator<functorReturn(argTypes&&...)>, identifierType, registryStorage, instrumentation> baseFactory;
+    };
+
+    /**
+     * @brief a factory over a fixed set of types known at compile time
+     *
+     * @details
+     * there is no registry and no registration, create() compares the id against the constexpr getFactoryID() of every type in objects and constructs the matching type directly so the compiler can inline the whole thing
+     * if the ids are integral (or an enum) and dense the dispatch is done through a constexpr jump table indexed by the id, otherwise through a chain of compares that optimizing compilers turn into a switch
+     *
+     * create() has the same signature as libFactory::BasicFactory::create() and libFactory::SingleArgumentFactory::create(), the arguments are forwarded to the constructor of the created type, types that are not constructible from the given arguments are skipped
+     *
+     * @note every type in objects has to implement a constexpr static getFactoryID() function, the ids have to be unique, both are checked at compile time
+     * @tparam baseClass the base class of all created objects, the identifier type is baseClass::__factoryIdentifierType__
+     * @tparam objects the types that can be created
+     *
+     * @see GoogleTests/staticFactoryTests.cpp
+     */
+    template<class baseClass, class... objects>
+    class StaticFactory{
+    public:
+        /**
+         * @brief the type of the identifier used to identify what object to create
+         */
+        typedef typename baseClass::__factoryIdentifierType__ identifierType;
+
+        /**
+         * @brief function to create a object from its id
+         * @param id the id of the object
+         * @param args the arguments that get forwarded to the constructor
+         * @return the created object
+         * @return nullptr if there is no type with that id or it is not constructible from args
+         */
+        template<class... argTypes>
+        static std::unique_ptr<baseClass> create(const identifierType& id, argTypes&&... args){
+            if constexpr (isDense){
+                typedef std::unique_ptr<baseClass> (*creatorType)(argTypes&&...);
+                static constexpr auto table = makeTable<creatorType, argTypes...>();
+                const auto index = static_cast<std::size_t>(toIndex(id) - minIndex);
+                if (toIndex(id) < minIndex || index >= table.size()){
+                    return nullptr;
+                }
+                return table[index](std::forward<argTypes>(args)...);
+            }else{
+                std::unique_ptr<baseClass> ret;
+                ((id == objects::getFactoryID() && (ret = createObject<objects>(std::forward<argTypes>(args)...), true)) || ...);
+                return ret;
+            }
+        }
+
+        /**
+         * @brief function to check if the factory knows an id
+         * @param id the id to look for
+         * @return true if one of the types has the id
+         */
+        static constexpr bool contains(const identifierType& id){
+            return ((id == objects::getFactoryID()) || ...);
+        }
+    private:
+        static constexpr std::array<identifierType, sizeof...(objects)> ids = {objects::getFactoryID()...};
+
+        static constexpr bool uniqueIDs(){
+            for (std::size_t i = 0; i < ids.size(); i++){
+                for (std::size_t j = i + 1; j < ids.size(); j++){
+                    if (ids[i] == ids[j]){
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        static_assert(uniqueIDs(), "libFactory::StaticFactory: two types have the same getFactoryID()");
+
+        static constexpr long long toIndex(const identifierType& id){
+            if constexpr (std::is_enum_v<identifierType>){
+                return static_cast<long long>(static_cast<std::underlying_type_t<identifierType>>(id));
+            }else{
+                return static_cast<long long>(id);
+            }
+        }
+
+        static constexpr long long indexBound(bool max){
+            long long ret = toIndex(ids[0]);
+            for (const auto& id : ids){
+                ret = max ? std::max(ret, toIndex(id)) : std::min(ret, toIndex(id));
+            }
+            return ret;
+        }
+
+        static constexpr bool denseIDs(){
+            if constexpr (sizeof...(objects) == 0 || !(std::is_integral_v<identifierType> || std::is_enum_v<identifierType>)){
+                return false;
+            }else{
+                // allow up to one unused table entry per type
+                return indexBound(true) - indexBound(false) < static_cast<long long>(2 * sizeof...(objects));
+            }
+        }
+
+        static constexpr bool isDense = denseIDs();
+        static constexpr long long minIndex = isDense ? indexBound(false) : 0;
+
+        template<class object, class... argTypes>
+        static std::unique_ptr<baseClass> createObject(argTypes&&... args){
+            if constexpr (std::is_constructible_v<object, argTypes...>){
+                return std::unique_ptr<baseClass>(new object(std::forward<argTypes>(args)...));
+            }else{
+                return nullptr;
+            }
+        }
+
+        template<class... argTypes>
+        static std::unique_ptr<baseClass> createNothing(argTypes&&...){
+            return nullptr;
+        }
+
+        template<class creatorType, class... argTypes>
+        static constexpr auto makeTable(){
+            std::array<creatorType, static_cast<std::size_t>(indexBound(true) - indexBound(false) + 1)> table{};
+            for (auto& entry : table){
+                entry = &createNothing<argTypes...>;
+            }
+            ((table[static_cast<std::size_t>(toIndex(objects::getFactoryID()) - minIndex)] = &createObject<objects, argTypes...>), ...);
+            return table;
+        }
     };
+
+    /**
+     * @brief a libFactory::BasicFactory that can be used from multiple threads, create() is wait free and can run while other threads register or remove objects
+     * @see libFactory::ConcurrentStorage
+     */
+    template<class baseClass, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>, template<class> class instrumentation = NoInstrumentation>
+    using ConcurrentBasicFactory = BasicFactory<baseClass, identifierType, functorReturn, ConcurrentStorage, instrumentation>;
+
+    /**
+     * @brief a libFactory::SingleArgumentFactory that can be used from multiple threads, create() is wait free and can run while other threads register or remove objects
+     * @see libFactory::ConcurrentStorage
+     */
+    template<class baseClass, class arg1Type, class identifierType = typename baseClass::__factoryIdentifierType__, typename functorReturn = std::unique_ptr<baseClass>, template<class> class instrumentation = NoInstrumentation>
+    using ConcurrentSingleArgumentFactory = SingleArgumentFactory<baseClass, arg1Type, identifierType, functorReturn, ConcurrentStorage, instrumentation>;
 }
 
 #endif //LIBFACTORY_LIBRARY_H
@@ -0,0 +1,498 @@
+#ifndef LIBFACTORY_ASYNC_H
+#define LIBFACTORY_ASYNC_H
+
+#include "libFactory.h"
+
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libFactory{
+
+    /**
+     * @brief a fixed size pool of worker threads with one task queue per worker
+     *
+     * @details
+     * tasks submitted from a worker go to the queue of that worker, tasks submitted from other threads are spread over the queues round robin.
+     * a worker runs the tasks of its own queue in submission order and steals the newest task of another queue when its own queue is empty, so a long running task does not hold up the tasks queued behind it
+     *
+     * shutdown() (and the destructor) runs all queued tasks to completion before the workers exit, tasks that are submitted once the shutdown started run on the submitting thread
+     *
+     * @note a pool with a single worker runs all tasks in submission order
+     * @warning tasks must not throw
+     */
+    class WorkerPool{
+    public:
+        /**
+         * @brief starts the worker threads
+         * @param workerCount the amount of worker threads, uses std::thread::hardware_concurrency() if 0
+         */
+        explicit WorkerPool(std::size_t workerCount = 0){
+            if (workerCount == 0){
+                workerCount = std::max(1u, std::thread::hardware_concurrency());
+            }
+            for (std::size_t i = 0; i < workerCount; i++){
+                queues.push_back(std::make_unique<taskQueue>());
+            }
+            for (std::size_t i = 0; i < workerCount; i++){
+                threads.emplace_back([this, i](){ work(i); });
+            }
+        }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        ~WorkerPool(){
+            shutdown();
+        }
+
+        /**
+         * @brief function to run a task on the pool
+         * @param function the task, a callable without arguments, it is moved into the pool
+         */
+        template<class functionType>
+        void submit(functionType&& function){
+            auto newTask = std::make_unique<callableTask<std::decay_t<functionType>>>(std::forward<functionType>(function));
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                if (!stopping){
+                    taskQueue& queue = currentWorker.pool == this ? *queues[currentWorker.index] : *queues[nextQueue++ % queues.size()];
+                    {
+                        std::lock_guard<std::mutex> queueLock(queue.mutex);
+                        queue.tasks.push_back(std::move(newTask));
+                    }
+                    queued.fetch_add(1, std::memory_order_release);
+                }
+            }
+            if (newTask){
+                newTask->run();
+                return;
+            }
+            wake.notify_one();
+        }
+
+        /**
+         * @brief function to run all queued tasks and stop the workers
+         * @note blocks until the workers exited, calling it more than once is fine
+         * @warning must not be called from a worker of the pool
+         */
+        void shutdown(){
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& thread : threads){
+                if (thread.joinable()){
+                    thread.join();
+                }
+            }
+        }
+
+        /**
+         * @brief function to get the amount of worker threads
+         * @return the amount of worker threads
+         */
+        std::size_t workerCount() const{
+            return queues.size();
+        }
+    private:
+        struct task{
+            virtual ~task() = default;
+            virtual void run() = 0;
+        };
+
+        template<class functionType>
+        struct callableTask: public task{
+            explicit callableTask(functionType function) : function(std::move(function)) {}
+            void run() override{
+                function();
+            }
+            functionType function;
+        };
+
+        struct taskQueue{
+            std::mutex mutex;
+            std::deque<std::unique_ptr<task>> tasks;
+        };
+
+        struct workerID{
+            const WorkerPool* pool;
+            std::size_t index;
+        };
+
+        std::unique_ptr<task> take(std::size_t index){
+            {
+                taskQueue& own = *queues[index];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty()){
+                    auto ret = std::move(own.tasks.front());
+                    own.tasks.pop_front();
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    return ret;
+                }
+            }
+            for (std::size_t i = 1; i < queues.size(); i++){
+                taskQueue& victim = *queues[(index + i) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()){
+                    auto ret = std::move(victim.tasks.back());
+                    victim.tasks.pop_back();
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    return ret;
+                }
+            }
+            return nullptr;
+        }
+
+        void work(std::size_t index){
+            currentWorker = {this, index};
+            for (;;){
+                if (auto next = take(index)){
+                    next->run();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait(lock, [this](){ return queued.load(std::memory_order_acquire) != 0 || stopping; });
+                if (stopping && queued.load(std::memory_order_acquire) == 0){
+                    return;
+                }
+            }
+        }
+
+        inline static thread_local workerID currentWorker{nullptr, 0};
+
+        std::vector<std::unique_ptr<taskQueue>> queues;
+        std::vector<std::thread> threads;
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        std::atomic<std::size_t> queued{0};
+        std::size_t nextQueue = 0;
+        bool stopping = false;
+    };
+
+    template<class factory>
+    class AsyncFactory;
+
+    /**
+     * @brief the result of an asynchronous creation, see libFactory::AsyncFactory::createAsync()
+     *
+     * @details
+     * works like a std::future that can also be awaited in a C++20 coroutine, co_await suspends the coroutine until the object is created and resumes it on the worker thread that created it.
+     * if the creator function threw the exception is rethrown by get() and by co_await
+     *
+     * @note the result can be taken once, with get() or co_await
+     * @tparam valueType the type returned by the creator functions
+     */
+    template<class valueType>
+    class AsyncResult{
+        template<class factory>
+        friend class AsyncFactory;
+
+        struct sharedState{
+            std::mutex mutex;
+            std::condition_variable done;
+            bool finished = false;
+            std::optional<valueType> value;
+            std::exception_ptr exception;
+            std::coroutine_handle<> continuation;
+
+            template<class function>
+            void run(function&& creator){
+                try{
+                    value.emplace(creator());
+                }catch (...){
+                    exception = std::current_exception();
+                }
+                std::coroutine_handle<> resume;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished = true;
+                    resume = std::exchange(continuation, nullptr);
+                }
+                done.notify_all();
+                if (resume){
+                    resume.resume();
+                }
+            }
+        };
+    public:
+        /**
+         * @brief constructs an invalid result
+         */
+        AsyncResult() = default;
+
+        /**
+         * @brief function to check if the result belongs to a creation
+         * @return true if the result belongs to a creation
+         * @return false if the result was default constructed
+         */
+        bool valid() const{
+            return state != nullptr;
+        }
+
+        /**
+         * @brief function to check if the creation finished
+         * @return true if get() does not block
+         * @return false if the creation did not finish yet or the result is invalid
+         */
+        bool ready() const{
+            if (!state){
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            return state->finished;
+        }
+
+        /**
+         * @brief function to wait until the creation finished
+         * @warning the result has to be valid
+         */
+        void wait() const{
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->done.wait(lock, [this](){ return state->finished; });
+        }
+
+        /**
+         * @brief function to wait for the created object and take it
+         * @warning the result has to be valid
+         * @return the return value of the creator function
+         * @throws the exception thrown by the creator function
+         */
+        valueType get(){
+            wait();
+            return take(*state);
+        }
+
+        /**
+         * @brief the awaiter returned by operator co_await
+         */
+        struct awaiter{
+            std::shared_ptr<sharedState> state;
+
+            bool await_ready() const{
+                std::lock_guard<std::mutex> lock(state->mutex);
+                return state->finished;
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle){
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->finished){
+                    return false;
+                }
+                state->continuation = handle;
+                return true;
+            }
+
+            valueType await_resume(){
+                return take(*state);
+            }
+        };
+
+        /**
+         * @brief function to await the created object in a coroutine
+         * @warning the result has to be valid
+         * @return the awaiter
+         */
+        awaiter operator co_await() const{
+            return awaiter{state};
+        }
+    private:
+        explicit AsyncResult(std::shared_ptr<sharedState> state) : state(std::move(state)) {}
+
+        static valueType take(sharedState& finishedState){
+            if (finishedState.exception){
+                std::rethrow_exception(finishedState.exception);
+            }
+            return std::move(*finishedState.value);
+        }
+
+        std::shared_ptr<sharedState> state;
+    };
+
+    /**
+     * @brief a factory that creates objects on a worker pool, so creators that block (loading files, models, ...) do not stall the calling thread
+     *
+     * @details
+     * createAsync() runs the creation on a libFactory::WorkerPool and returns a libFactory::AsyncResult that can be waited on or awaited in a coroutine.
+     * prewarm() creates objects of an id ahead of demand into a ready queue, create() and createAsync() hand out the objects of the ready queue first, in the order they were finished
+     *
+     * the pool is started on first use with setWorkerCount() worker threads, shutdown() runs all queued creations to completion and stops it, the next asynchronous creation starts a new pool
+     *
+     * @note objects of the ready queue were created with the arguments passed to prewarm(), the arguments passed to create() are not used when a prewarmed object is returned, so prewarm only ids whose objects do not depend on the arguments
+     * @note create() checks the ready queues only when objects are prewarmed, otherwise it costs one atomic load more than the wrapped factory
+     * @warning the creator functions run on the worker threads, so they have to be thread safe and the wrapped factory has to use a registry storage that can be written while other threads create objects (see libFactory::ConcurrentStorage) if objects are registered while creations are running
+     * @tparam factory the factory to wrap, for example libFactory::SingleArgumentFactory
+     * @see GoogleTests/asyncFactoryTests.cpp
+     */
+    template<class factory>
+    class AsyncFactory: public factory{
+    public:
+        /**
+         * @brief the identifier type of the wrapped factory
+         */
+        typedef typename factory::factoryIdentifierType identifierType;
+
+        /**
+         * @brief the type returned by the creator functions of the wrapped factory
+         */
+        typedef typename SignatureReturn<typename CreatorSignature<typename factory::factoryCreatorFunctionType>::type>::type returnType;
+
+        /**
+         * @brief the result type of createAsync()
+         */
+        typedef AsyncResult<returnType> resultType;
+
+        /**
+         * @brief function to create a object from its id, takes a prewarmed object if there is one
+         * @param id the id of the object
+         * @param args the arguments passed to create() of the wrapped factory
+         * @return a prewarmed object or the return value of the creator function
+         * @return nullptr if the id is not registered
+         */
+        template<class... argTypes>
+        static returnType create(IdentifierView<identifierType> id, argTypes&&... args){
+            if (auto& state = getAsyncState(); state.prewarmed.load(std::memory_order_acquire) != 0){
+                std::lock_guard<std::mutex> lock(state.readyMutex);
+                if (auto it = state.ready.find(id); it != state.ready.end() && !it->second.empty()){
+                    returnType ret = std::move(it->second.front());
+                    it->second.pop_front();
+                    state.prewarmed.fetch_sub(1, std::memory_order_relaxed);
+                    return ret;
+                }
+            }
+            return factory::create(id, std::forward<argTypes>(args)...);
+        }
+
+        /**
+         * @brief function to create a object from its id on the worker pool
+         * @param id the id of the object
+         * @param args the arguments passed to create() of the wrapped factory, they are copied or moved into the pool
+         * @return the result that gets the created object, the object is nullptr if the id is not registered
+         */
+        template<class... argTypes>
+        static resultType createAsync(IdentifierView<identifierType> id, argTypes&&... args){
+            auto state = std::make_shared<typename resultType::sharedState>();
+            getPool()->submit([state, id = identifierType(id), ...args = std::forward<argTypes>(args)]() mutable{
+                state->run([&](){ return create(id, std::move(args)...); });
+            });
+            return resultType(std::move(state));
+        }
+
+        /**
+         * @brief function to create objects of an id ahead of demand on the worker pool
+         * @note creations that return nullptr or throw do not add an object to the ready queue
+         * @param id the id of the objects
+         * @param count the amount of objects to create
+         * @param args the arguments passed to create() of the wrapped factory, every creation gets its own copy
+         * @return true if the creations were queued
+         * @return false if the id is not registered
+         */
+        template<class... argTypes>
+        static bool prewarm(IdentifierView<identifierType> id, std::size_t count, const argTypes&... args){
+            if (!factory::findEntry(id)){
+                return false;
+            }
+            auto pool = getPool();
+            for (std::size_t i = 0; i < count; i++){
+                pool->submit([id = identifierType(id), ...args = args]() mutable{
+                    try{
+                        if (returnType object = factory::create(id, std::move(args)...)){
+                            auto& state = getAsyncState();
+                            std::lock_guard<std::mutex> lock(state.readyMutex);
+                            state.ready[id].push_back(std::move(object));
+                            state.prewarmed.fetch_add(1, std::memory_order_release);
+                        }
+                    }catch (...){}
+                });
+            }
+            return true;
+        }
+
+        /**
+         * @brief function to get the amount of prewarmed objects of an id that are ready
+         * @param id the id
+         * @return the amount of ready objects
+         */
+        static std::size_t getPrewarmedCount(IdentifierView<identifierType> id){
+            auto& state = getAsyncState();
+            std::lock_guard<std::mutex> lock(state.readyMutex);
+            auto it = state.ready.find(id);
+            return it != state.ready.end() ? it->second.size() : 0;
+        }
+
+        /**
+         * @brief function to destroy all prewarmed objects that are ready
+         * @note prewarm creations that are still queued add their objects afterwards
+         */
+        static void clearPrewarmed(){
+            auto& state = getAsyncState();
+            std::lock_guard<std::mutex> lock(state.readyMutex);
+            state.ready.clear();
+            state.prewarmed.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief function to set the amount of worker threads
+         * @details stops the running pool like shutdown(), the next asynchronous creation starts a pool with the new amount of workers
+         * @param workerCount the amount of worker threads, uses std::thread::hardware_concurrency() if 0
+         */
+        static void setWorkerCount(std::size_t workerCount){
+            auto& state = getAsyncState();
+            {
+                std::lock_guard<std::mutex> lock(state.poolMutex);
+                state.workerCount = workerCount;
+            }
+            shutdown();
+        }
+
+        /**
+         * @brief function to run all queued creations to completion and stop the worker pool
+         * @note blocks until the queued creations finished, creations that are started while the pool shuts down run on the calling thread
+         * @warning must not be called from a creator function
+         */
+        static void shutdown(){
+            auto& state = getAsyncState();
+            std::shared_ptr<WorkerPool> pool;
+            {
+                std::lock_guard<std::mutex> lock(state.poolMutex);
+                pool = std::move(state.pool);
+            }
+            if (pool){
+                pool->shutdown();
+            }
+        }
+    private:
+        struct asyncState{
+            std::mutex readyMutex;
+            std::map<identifierType, std::deque<returnType>, std::less<>> ready;
+            std::atomic<std::size_t> prewarmed{0};
+            std::mutex poolMutex;
+            std::size_t workerCount = 0;
+            // destroyed first, so the queued creations can still use the ready queues while the pool shuts down
+            std::shared_ptr<WorkerPool> pool;
+        };
+
+        static asyncState& getAsyncState(){
+            static asyncState state;
+            return state;
+        }
+
+        static std::shared_ptr<WorkerPool> getPool(){
+            auto& state = getAsyncState();
+            std::lock_guard<std::mutex> lock(state.poolMutex);
+            if (!state.pool){
+                state.pool = std::make_shared<WorkerPool>(state.workerCount);
+            }
+            return state.pool;
+        }
+    };
+}
+
+#endif //LIBFACTORY_ASYNC_H
@@ -0,0 +1,180 @@
+#ifndef LIBFACTORY_PLUGINS_H
+#define LIBFACTORY_PLUGINS_H
+
+#include "libFactory.h"
+
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include <dlfcn.h>
+
+namespace libFactory{
+
+    /**
+     * @brief a factory that loads the shared object an id lives in the first time the id is created
+     *
+     * @details
+     * ids are mapped to shared object paths with registerPlugin() or a manifest file (see loadManifest()), the shared objects are not loaded at startup.
+     * when create() does not find an id in the registry it dlopen()s the shared object of the id, the autoRegister static initializers in it register its objects with the factory and create() looks the id up again.
+     * every shared object is loaded at most once, also when multiple threads miss ids of the same shared object at the same time, and is never unloaded. a shared object that failed to load is not tried again
+     *
+     * the shared objects have to register with the factory type that PluginFactory wraps and the binary has to export its symbols (ENABLE_EXPORTS in cmake, -rdynamic) so that the shared objects use the same registry as the binary
+     *
+     * @note loading plugins is thread safe, but the wrapped factory has to use a registry storage that can be written while other threads create objects (see libFactory::ConcurrentStorage) to call create() from multiple threads
+     * @note create() looks every id up once more than the wrapped factory does to find out if it has to load a plugin
+     * @warning only available on platforms with dlopen()
+     * @tparam factory the factory to wrap, for example libFactory::ConcurrentBasicFactory
+     * @see GoogleTests/pluginFactoryTests.cpp
+     */
+    template<class factory>
+    class PluginFactory: public factory{
+    public:
+        /**
+         * @brief the identifier type of the wrapped factory
+         */
+        typedef typename factory::factoryIdentifierType identifierType;
+
+        /**
+         * @brief function to create a object from its id, loads the plugin of the id if it is not registered yet
+         * @param id the id of the object
+         * @param args the arguments passed to create() of the wrapped factory
+         * @return the return value of the creator function
+         * @return nullptr if the id is not registered and is not registered by its plugin either
+         */
+        template<class... argTypes>
+        static auto create(IdentifierView<identifierType> id, argTypes&&... args){
+            if (!factory::findEntry(id)){
+                loadPlugin(id);
+            }
+            return factory::create(id, std::forward<argTypes>(args)...);
+        }
+
+        /**
+         * @brief function to map an id to the shared object that registers it
+         * @note multiple ids can be mapped to the same path, the shared object is loaded once for all of them
+         * @param id the id
+         * @param path the path of the shared object, passed to dlopen() as is
+         * @return true if the id was mapped
+         * @return false if the id is already mapped to a shared object
+         */
+        static bool registerPlugin(IdentifierView<identifierType> id, const std::string& path){
+            auto& plugins = getPluginRegistry();
+            std::lock_guard<std::mutex> lock(plugins.mutex);
+            auto libraryIt = plugins.libraryIndices.find(path);
+            std::size_t index = libraryIt != plugins.libraryIndices.end() ? libraryIt->second : plugins.libraries.size();
+            if (!plugins.ids.insert(id, index)){
+                return false;
+            }
+            if (index == plugins.libraries.size()){
+                plugins.libraries.emplace_back().path = path;
+                plugins.libraryIndices.emplace(path, index);
+            }
+            return true;
+        }
+
+        /**
+         * @brief function to map all ids listed in a manifest file to their shared objects
+         *
+         * @details
+         * every line of the manifest contains an id and the path of its shared object separated by whitespace, the path is the rest of the line.
+         * empty lines and lines that start with # are skipped. the id is read with operator>> so identifierType has to support it
+         *
+         * @param manifestPath the path of the manifest file
+         * @return true if every line was mapped
+         * @return false if the file could not be opened or a line could not be read or mapped, the other lines are still mapped
+         */
+        static bool loadManifest(const std::string& manifestPath){
+            std::ifstream manifest(manifestPath);
+            if (!manifest){
+                return false;
+            }
+            bool ret = true;
+            std::string line;
+            while (std::getline(manifest, line)){
+                std::istringstream lineStream(line);
+                identifierType id;
+                lineStream >> std::ws;
+                if (lineStream.peek() == std::char_traits<char>::eof() || lineStream.peek() == '#'){
+                    continue;
+                }
+                std::string path;
+                if (!(lineStream >> id) || !std::getline(lineStream >> std::ws, path) || path.empty()){
+                    ret = false;
+                    continue;
+                }
+                path.erase(path.find_last_not_of(" \t\r") + 1);
+                ret = registerPlugin(id, path) && ret;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief function to load the shared object of an id if it is not loaded yet
+         * @param id the id
+         * @return true if the shared object is loaded
+         * @return false if the id is not mapped to a shared object or it could not be loaded
+         */
+        static bool loadPlugin(IdentifierView<identifierType> id){
+            library* plugin = findLibrary(id);
+            if (!plugin){
+                return false;
+            }
+            std::call_once(plugin->loadFlag, [plugin](){
+                plugin->handle = dlopen(plugin->path.c_str(), RTLD_NOW | RTLD_LOCAL);
+                if (!plugin->handle){
+                    const char* error = dlerror();
+                    plugin->error = error ? error : "unknown dlopen error";
+                }
+                plugin->attempted.store(true, std::memory_order_release);
+            });
+            return plugin->handle != nullptr;
+        }
+
+        /**
+         * @brief function to get the error of the shared object of an id that failed to load
+         * @param id the id
+         * @return the dlerror() message
+         * @return an empty string if the id is not mapped, the shared object was not loaded yet or it was loaded
+         */
+        static std::string getPluginError(IdentifierView<identifierType> id){
+            library* plugin = findLibrary(id);
+            if (!plugin || !plugin->attempted.load(std::memory_order_acquire)){
+                return {};
+            }
+            return plugin->error;
+        }
+    private:
+        struct library{
+            std::string path;
+            std::once_flag loadFlag;
+            std::atomic<bool> attempted{false};
+            void* handle = nullptr;
+            std::string error;
+        };
+
+        struct pluginRegistry{
+            std::mutex mutex;
+            MapStorage<identifierType, std::size_t> ids;
+            std::map<std::string, std::size_t> libraryIndices;
+            std::deque<library> libraries;
+        };
+
+        static pluginRegistry& getPluginRegistry(){
+            static pluginRegistry plugins;
+            return plugins;
+        }
+
+        static library* findLibrary(IdentifierView<identifierType> id){
+            auto& plugins = getPluginRegistry();
+            std::lock_guard<std::mutex> lock(plugins.mutex);
+            const std::size_t* index = plugins.ids.find(id);
+            return index ? &plugins.libraries[*index] : nullptr;
+        }
+    };
+}
+
+#endif //LIBFACTORY_PLUGINS_H
@@ -0,0 +1,699 @@
+#ifndef LIBFACTORY_STREAM_H
+#define LIBFACTORY_STREAM_H
+
+#include "libFactory.h"
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace libFactory{
+
+    /**
+     * @brief a read only memory mapping of a whole file
+     * @note an empty file is mapped as an empty span
+     * @warning only available on platforms with mmap()
+     */
+    class MappedFile{
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief maps a file, check valid() to see if it worked
+         * @param path the path of the file
+         */
+        explicit MappedFile(const std::string& path){
+            open(path);
+        }
+
+        MappedFile(MappedFile&& other) noexcept : address(std::exchange(other.address, nullptr)), length(std::exchange(other.length, 0)), opened(std::exchange(other.opened, false)) {}
+
+        MappedFile& operator=(MappedFile&& other) noexcept{
+            if (this != &other){
+                close();
+                address = std::exchange(other.address, nullptr);
+                length = std::exchange(other.length, 0);
+                opened = std::exchange(other.opened, false);
+            }
+            return *this;
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile(){
+            close();
+        }
+
+        /**
+         * @brief function to map a file, unmaps the file that was mapped before
+         * @param path the path of the file
+         * @return true if the file was mapped
+         * @return false if the file could not be opened or mapped
+         */
+        bool open(const std::string& path){
+            close();
+            int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor < 0){
+                return false;
+            }
+            struct stat info{};
+            bool ret = ::fstat(descriptor, &info) == 0;
+            if (ret && info.st_size > 0){
+                auto size = static_cast<std::size_t>(info.st_size);
+                void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (mapped == MAP_FAILED){
+                    ret = false;
+                }else{
+                    // the records are read front to back, let the kernel read ahead aggressively
+                    ::madvise(mapped, size, MADV_SEQUENTIAL);
+                    address = mapped;
+                    length = size;
+                }
+            }
+            ::close(descriptor);
+            opened = ret;
+            return ret;
+        }
+
+        /**
+         * @brief function to unmap the file
+         */
+        void close(){
+            if (address){
+                ::munmap(address, length);
+            }
+            address = nullptr;
+            length = 0;
+            opened = false;
+        }
+
+        /**
+         * @brief check if a file is mapped
+         */
+        bool valid() const{
+            return opened;
+        }
+
+        /**
+         * @brief the contents of the file, valid until the file is closed
+         */
+        std::span<const std::byte> data() const{
+            return {static_cast<const std::byte*>(address), length};
+        }
+    private:
+        void* address = nullptr;
+        std::size_t length = 0;
+        bool opened = false;
+    };
+
+    /**
+     * @brief the header in front of every record of a record stream
+     *
+     * @details
+     * a record stream is a sequence of records, each one is a RecordHeader followed by idSize bytes of encoded id (see libFactory::RecordIdentifierCodec) and payloadSize bytes of payload, without any padding.
+     * the sizes are stored in the byte order of the machine that wrote the stream
+     */
+    struct RecordHeader{
+        /**
+         * @brief the size of the encoded id in bytes
+         */
+        std::uint32_t idSize;
+
+        /**
+         * @brief the size of the payload in bytes
+         */
+        std::uint32_t payloadSize;
+    };
+
+    /**
+     * @brief describes how identifiers are stored in a record stream
+     *
+     * @details
+     * trivially copyable identifiers are stored as their bytes, std::string identifiers as their characters and decode to a std::string_view that points into the stream, so reading a record never allocates.
+     * libFactory::FactoryId identifiers are stored as their hash and decode to an id without a name.
+     * specialize this for your own identifier types, decodedType has to be convertible to libFactory::IdentifierView
+     *
+     * @tparam identifierType the type of the identifier
+     */
+    template<class identifierType>
+    struct RecordIdentifierCodec{
+        static_assert(std::is_trivially_copyable_v<identifierType>, "specialize libFactory::RecordIdentifierCodec for identifier types that are not trivially copyable");
+
+        /**
+         * @brief the type an encoded id is decoded to
+         */
+        typedef identifierType decodedType;
+
+        /**
+         * @brief function to get the size of an encoded id
+         * @param id the id
+         * @return the size of the encoded id in bytes
+         */
+        static std::size_t size(IdentifierView<identifierType>){
+            return sizeof(identifierType);
+        }
+
+        /**
+         * @brief function to encode an id
+         * @param id the id
+         * @param buffer the buffer to encode the id into, has size(id) bytes
+         */
+        static void encode(IdentifierView<identifierType> id, std::byte* buffer){
+            std::memcpy(buffer, &id, sizeof(identifierType));
+        }
+
+        /**
+         * @brief function to decode an id
+         * @param bytes the encoded id
+         * @param id the decoded id
+         * @return true if the id was decoded
+         * @return false if bytes is not a valid encoded id
+         */
+        static bool decode(std::span<const std::byte> bytes, decodedType& id){
+            if (bytes.size() != sizeof(identifierType)){
+                return false;
+            }
+            std::memcpy(&id, bytes.data(), sizeof(identifierType));
+            return true;
+        }
+    };
+
+    template<class charTraits, class allocatorType>
+    struct RecordIdentifierCodec<std::basic_string<char, charTraits, allocatorType>>{
+        typedef std::basic_string_view<char, charTraits> decodedType;
+
+        static std::size_t size(decodedType id){
+            return id.size();
+        }
+
+        static void encode(decodedType id, std::byte* buffer){
+            std::memcpy(buffer, id.data(), id.size());
+        }
+
+        static bool decode(std::span<const std::byte> bytes, decodedType& id){
+            id = decodedType(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            return true;
+        }
+    };
+
+    template<>
+    struct RecordIdentifierCodec<FactoryId>{
+        // only the hash is stored, the name would point into the memory of the writing process
+        typedef FactoryId decodedType;
+
+        static std::size_t size(const FactoryId&){
+            return sizeof(std::uint64_t);
+        }
+
+        static void encode(const FactoryId& id, std::byte* buffer){
+            std::uint64_t value = id.getValue();
+            std::memcpy(buffer, &value, sizeof(value));
+        }
+
+        static bool decode(std::span<const std::byte> bytes, decodedType& id){
+            if (bytes.size() != sizeof(std::uint64_t)){
+                return false;
+            }
+            std::uint64_t value;
+            std::memcpy(&value, bytes.data(), sizeof(value));
+            id = FactoryId::fromValue(value);
+            return true;
+        }
+    };
+
+    /**
+     * @brief writes a record stream to a file, see libFactory::RecordHeader for the format
+     * @tparam identifierType the type of the identifier
+     */
+    template<class identifierType>
+    class RecordWriter{
+    public:
+        /**
+         * @brief creates or truncates the file, check valid() to see if it worked
+         * @param path the path of the file
+         */
+        explicit RecordWriter(const std::string& path) : file(path, std::ios::binary | std::ios::trunc) {}
+
+        /**
+         * @brief check if the file is open and all writes so far succeeded
+         */
+        bool valid() const{
+            return file.is_open() && file.good();
+        }
+
+        /**
+         * @brief function to append a record
+         * @param id the id of the record
+         * @param payload the payload of the record
+         * @return true if the record was written
+         * @return false if the id or payload are larger than 4 GiB or writing failed
+         */
+        bool write(IdentifierView<identifierType> id, std::span<const std::byte> payload){
+            std::size_t idSize = RecordIdentifierCodec<identifierType>::size(id);
+            if (idSize > std::numeric_limits<std::uint32_t>::max() || payload.size() > std::numeric_limits<std::uint32_t>::max()){
+                return false;
+            }
+            RecordHeader header{static_cast<std::uint32_t>(idSize), static_cast<std::uint32_t>(payload.size())};
+            buffer.resize(sizeof(RecordHeader) + idSize);
+            std::memcpy(buffer.data(), &header, sizeof(RecordHeader));
+            RecordIdentifierCodec<identifierType>::encode(id, buffer.data() + sizeof(RecordHeader));
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            return file.good();
+        }
+
+        /**
+         * @brief function to flush and close the file
+         * @return true if all records were written
+         * @return false if a write failed
+         */
+        bool close(){
+            file.close();
+            return !file.fail();
+        }
+    private:
+        std::ofstream file;
+        std::vector<std::byte> buffer;
+    };
+
+    /**
+     * @brief a record of a record stream, points into the stream
+     * @tparam identifierType the type of the identifier
+     */
+    template<class identifierType>
+    struct RecordView{
+        /**
+         * @brief the id of the record
+         */
+        typename RecordIdentifierCodec<identifierType>::decodedType id;
+
+        /**
+         * @brief the payload of the record
+         */
+        std::span<const std::byte> payload;
+    };
+
+    /**
+     * @brief the records of a record stream in memory, decodes one record at a time while it is iterated
+     *
+     * @details
+     * iteration stops at the end of the data or at the first record that is cut off or has an id that can not be decoded, complete() tells the two apart
+     *
+     * @tparam identifierType the type of the identifier
+     */
+    template<class identifierType>
+    class RecordRange{
+    public:
+        /**
+         * @brief the record typedef
+         */
+        typedef RecordView<identifierType> recordType;
+
+        /**
+         * @brief iterates the records of the range, the records point into the data of the range
+         */
+        class iterator{
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef recordType value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const recordType* pointer;
+            typedef const recordType& reference;
+
+            iterator() = default;
+
+            reference operator*() const{
+                return record;
+            }
+
+            pointer operator->() const{
+                return &record;
+            }
+
+            iterator& operator++(){
+                offset = next;
+                if (!parse(data, offset, record, next)){
+                    next = offset = data.size();
+                }
+                return *this;
+            }
+
+            iterator operator++(int){
+                iterator ret = *this;
+                ++*this;
+                return ret;
+            }
+
+            bool operator==(const iterator& other) const{
+                return offset == other.offset;
+            }
+
+            /**
+             * @brief the offset of the current record in the data of the range
+             */
+            std::size_t position() const{
+                return offset;
+            }
+        private:
+            friend class RecordRange;
+
+            iterator(std::span<const std::byte> data, std::size_t offset) : data(data), offset(offset), next(offset) {
+                if (offset != data.size()){
+                    ++*this;
+                }
+            }
+
+            std::span<const std::byte> data;
+            std::size_t offset = 0;
+            std::size_t next = 0;
+            recordType record{};
+        };
+
+        RecordRange() = default;
+
+        /**
+         * @brief creates a range over a record stream
+         * @param data the record stream, has to outlive the range
+         */
+        explicit RecordRange(std::span<const std::byte> data) : data(data) {}
+
+        /**
+         * @brief the first record
+         */
+        iterator begin() const{
+            return iterator(data, 0);
+        }
+
+        /**
+         * @brief the end of the records
+         */
+        iterator end() const{
+            return iterator(data, data.size());
+        }
+
+        /**
+         * @brief the range of the records that start at or after an offset
+         * @param first the offset of a record, for example iterator::position()
+         * @param last the offset after the last record
+         * @return the records from first up to last
+         */
+        RecordRange subrange(std::size_t first, std::size_t last) const{
+            return RecordRange(data.subspan(first, last - first));
+        }
+
+        /**
+         * @brief the data of the range
+         */
+        std::span<const std::byte> bytes() const{
+            return data;
+        }
+
+        /**
+         * @brief check if every record of the range is intact, walks the record headers
+         * @return true if the data ends exactly after the last record and all ids can be decoded
+         * @return false if a record is cut off or an id can not be decoded
+         */
+        bool complete() const{
+            std::size_t offset = 0;
+            recordType record;
+            std::size_t next = 0;
+            while (offset != data.size()){
+                if (!parse(data, offset, record, next)){
+                    return false;
+                }
+                offset = next;
+            }
+            return true;
+        }
+
+        /**
+         * @brief function to decode the record at an offset
+         * @param data the record stream
+         * @param offset the offset of the record
+         * @param record the decoded record
+         * @param next the offset of the record after it
+         * @return true if the record was decoded
+         * @return false if the record is cut off or its id can not be decoded
+         */
+        static bool parse(std::span<const std::byte> data, std::size_t offset, recordType& record, std::size_t& next){
+            if (data.size() - offset < sizeof(RecordHeader)){
+                return false;
+            }
+            RecordHeader header;
+            std::memcpy(&header, data.data() + offset, sizeof(RecordHeader));
+            std::size_t idOffset = offset + sizeof(RecordHeader);
+            if (data.size() - idOffset < std::size_t(header.idSize) + header.payloadSize){
+                return false;
+            }
+            if (!RecordIdentifierCodec<identifierType>::decode(data.subspan(idOffset, header.idSize), record.id)){
+                return false;
+            }
+            record.payload = data.subspan(idOffset + header.idSize, header.payloadSize);
+            next = idOffset + header.idSize + header.payloadSize;
+            return true;
+        }
+    private:
+        std::span<const std::byte> data;
+    };
+
+    /**
+     * @brief a factory that rebuilds objects from record streams, every record is created by passing its payload to the creator function of its id
+     *
+     * @details
+     * readRecords() memory maps a record stream file (see libFactory::RecordHeader and libFactory::RecordWriter) and returns a libFactory::StreamFactory::recordStream.
+     * iterating the stream creates one object per record while it goes, so only the current record has to be in memory and the payloads are handed to the creators as spans into the mapping, without copying them.
+     * createAll() creates all objects at once and can split the records into chunks that are created on multiple threads
+     *
+     * @note the creator functions of the wrapped factory have to take a std::span<const std::byte> as their only argument, for example libFactory::SingleArgumentFactory<base, std::span<const std::byte>>
+     * @warning the payloads only live as long as the stream, creators must copy whatever they want to keep
+     * @warning only available on platforms with mmap()
+     * @tparam factory the factory to wrap
+     * @see GoogleTests/streamFactoryTests.cpp
+     */
+    template<class factory>
+    class StreamFactory: public factory{
+    public:
+        /**
+         * @brief the identifier type of the wrapped factory
+         */
+        typedef typename factory::factoryIdentifierType identifierType;
+
+        /**
+         * @brief the type returned by the creator functions of the wrapped factory
+         */
+        typedef typename SignatureReturn<typename CreatorSignature<typename factory::factoryCreatorFunctionType>::type>::type returnType;
+
+        /**
+         * @brief the record range typedef
+         */
+        typedef RecordRange<identifierType> recordRangeType;
+
+        /**
+         * @brief a record stream that creates an object for each of its records
+         * @note move only, the stream owns the mapping of the file
+         */
+        class recordStream{
+        public:
+            /**
+             * @brief iterates the objects of the stream, each object is created when the iterator is dereferenced
+             */
+            class iterator{
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef returnType value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef void pointer;
+                typedef returnType reference;
+
+                iterator() = default;
+
+                /**
+                 * @brief creates the object of the current record
+                 * @return the return value of the creator function
+                 * @return nullptr if the id of the record is not registered
+                 */
+                returnType operator*() const{
+                    return factory::create(record->id, record->payload);
+                }
+
+                iterator& operator++(){
+                    ++record;
+                    return *this;
+                }
+
+                iterator operator++(int){
+                    iterator ret = *this;
+                    ++record;
+                    return ret;
+                }
+
+                bool operator==(const iterator& other) const{
+                    return record == other.record;
+                }
+
+                /**
+                 * @brief the current record
+                 */
+                const typename recordRangeType::recordType& getRecord() const{
+                    return *record;
+                }
+            private:
+                friend class recordStream;
+
+                explicit iterator(typename recordRangeType::iterator record) : record(record) {}
+
+                typename recordRangeType::iterator record;
+            };
+
+            recordStream() = default;
+
+            /**
+             * @brief check if the stream has data, false if its file could not be mapped
+             */
+            bool valid() const{
+                return opened;
+            }
+
+            /**
+             * @brief check if every record of the stream is intact, see libFactory::RecordRange::complete()
+             */
+            bool complete() const{
+                return records.complete();
+            }
+
+            /**
+             * @brief the records of the stream without creating objects
+             */
+            const recordRangeType& getRecords() const{
+                return records;
+            }
+
+            /**
+             * @brief the object of the first record
+             */
+            iterator begin() const{
+                return iterator(records.begin());
+            }
+
+            /**
+             * @brief the end of the objects
+             */
+            iterator end() const{
+                return iterator(records.end());
+            }
+
+            /**
+             * @brief function to create the objects of all records
+             *
+             * @details
+             * with more than one thread the records are split into chunks of about the same size in bytes, one per thread, the calling thread creates the first chunk.
+             * the objects are returned in record order either way
+             *
+             * @note the creator functions have to be safe to call from multiple threads when threadCount is not 1
+             * @param threadCount the amount of threads that create objects, uses std::thread::hardware_concurrency() if 0
+             * @return the objects, nullptr for records whose id is not registered
+             * @throws the exception of the first chunk whose creator function threw, the other chunks are finished first
+             */
+            std::vector<returnType> createAll(std::size_t threadCount = 1) const{
+                if (threadCount == 0){
+                    threadCount = std::max(1u, std::thread::hardware_concurrency());
+                }
+                // one pass over the headers counts the records and finds the chunk boundaries
+                std::span<const std::byte> data = records.bytes();
+                std::vector<std::pair<std::size_t, std::size_t>> chunks; // offset and index of the first record of every chunk
+                std::size_t count = 0;
+                for (auto it = records.begin(); it != records.end(); ++it, ++count){
+                    if (it.position() >= chunks.size() * data.size() / threadCount){
+                        chunks.emplace_back(it.position(), count);
+                    }
+                }
+                std::vector<returnType> ret(count);
+                if (chunks.empty()){
+                    return ret;
+                }
+                chunks.emplace_back(data.size(), count);
+                auto createChunk = [&](std::size_t chunk){
+                    std::size_t index = chunks[chunk].second;
+                    for (const auto& record : records.subrange(chunks[chunk].first, chunks[chunk + 1].first)){
+                        ret[index++] = factory::create(record.id, record.payload);
+                    }
+                };
+                std::vector<std::exception_ptr> exceptions(chunks.size() - 1);
+                std::vector<std::thread> threads;
+                threads.reserve(chunks.size() - 2);
+                for (std::size_t chunk = 1; chunk + 1 < chunks.size(); chunk++){
+                    threads.emplace_back([&createChunk, &exceptions, chunk](){
+                        try{
+                            createChunk(chunk);
+                        }catch (...){
+                            exceptions[chunk] = std::current_exception();
+                        }
+                    });
+                }
+                try{
+                    createChunk(0);
+                }catch (...){
+                    exceptions[0] = std::current_exception();
+                }
+                for (auto& thread : threads){
+                    thread.join();
+                }
+                for (const auto& exception : exceptions){
+                    if (exception){
+                        std::rethrow_exception(exception);
+                    }
+                }
+                return ret;
+            }
+        private:
+            friend class StreamFactory;
+
+            explicit recordStream(MappedFile&& mappedFile) : file(std::move(mappedFile)), records(file.data()), opened(true) {}
+
+            explicit recordStream(std::span<const std::byte> data) : records(data), opened(true) {}
+
+            MappedFile file;
+            recordRangeType records;
+            bool opened = false;
+        };
+
+        /**
+         * @brief function to memory map a record stream file
+         * @param path the path of the file
+         * @return the record stream
+         * @return an invalid stream (see recordStream::valid()) if the file could not be mapped
+         */
+        static recordStream readRecords(const std::string& path){
+            MappedFile file(path);
+            if (!file.valid()){
+                return recordStream();
+            }
+            return recordStream(std::move(file));
+        }
+
+        /**
+         * @brief function to read a record stream that is already in memory
+         * @param data the record stream, has to outlive the returned stream
+         * @return the record stream
+         */
+        static recordStream readRecords(std::span<const std::byte> data){
+            return recordStream(data);
+        }
+    };
+}
+
+#endif //LIBFACTORY_STREAM_H